@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- App model ---------------------------------------------
+ * The ui task owns the working copy (main.cpp 'g') and publishes it here
+ * after every change; any other task reads a consistent snapshot of all
+ * fields through a seqlock (include/seqlock.h) without blocking the UI.
+ * ----------------------------------------------------------------------- */
+enum class PlayPreset : uint8_t { None=0, WhiteNoise, Rain, Heartbeat, Lullaby };
+
+struct AppModel {
+  uint8_t  soundLevel;         // 0..100 (simulated)
+  bool     cryLikely;
+  bool     motion;
+  uint32_t lastMotionMs;
+  PlayPreset playing;
+  uint8_t  volume;             // 0..100
+  uint8_t  cryThresh;          // threshold (sim)
+};
+
+#ifndef APP_MODEL_STRESS_MS
+#define APP_MODEL_STRESS_MS 2000
+#endif
+
+void     app_model_publish(const AppModel& m);      // writer side (ui task)
+AppModel app_model_read(uint32_t* version = nullptr);
+uint32_t app_model_version();                      // bumps once per publish
+
+// On-target torn-read check: writer on core 0, reader on core 1, both
+// spinning for APP_MODEL_STRESS_MS on a private seqlock; reports when done
+bool app_model_stress_start();
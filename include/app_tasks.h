@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/* ---------------- Task layout ------------------------------------------
+ *   core 1  ui       the only task that touches LVGL: drains the UI queue,
+ *                    then lv_timer_handler() (touch indev read included),
+ *                    then sleeps on its task notification until the next
+ *                    LVGL timer is due or ui_wake() (queue post, touch INT)
+ *   core 0  i2c_bus  touch sampling + expander/diag jobs (i2c_bus.cpp)
+ *   core 0  io       Serial input -> UI queue (KEY)
+ *   core 0  net      inbound telemetry -> UI queue (TELEMETRY), outbound
+ *                    state from the NET queue; MQTT plugs in here
+ *
+ * Tasks talk through bounded queues only. Producers never block on a full
+ * queue: the message is dropped and counted, so a stalled network side can
+ * never hold up a frame. Serial 'M' prints stack high-water marks, queue
+ * peaks and drops per task.
+ * ----------------------------------------------------------------------- */
+#ifndef APP_UI_CORE
+#define APP_UI_CORE 1
+#endif
+#ifndef APP_IO_CORE
+#define APP_IO_CORE 0            // shared with i2c_bus (I2C_BUS_TASK_CORE)
+#endif
+#ifndef APP_UI_PRIO
+#define APP_UI_PRIO 2
+#endif
+#ifndef APP_IO_PRIO
+#define APP_IO_PRIO 2
+#endif
+#ifndef APP_NET_PRIO
+#define APP_NET_PRIO 1           // below the bus task: network work yields to touch
+#endif
+#ifndef APP_UI_STACK
+#define APP_UI_STACK 8192        // LVGL draw + event callbacks + printf
+#endif
+#ifndef APP_IO_STACK
+#define APP_IO_STACK 3072
+#endif
+#ifndef APP_NET_STACK
+#define APP_NET_STACK 4096
+#endif
+#ifndef APP_UI_QUEUE_LEN
+#define APP_UI_QUEUE_LEN 16
+#endif
+#ifndef APP_NET_QUEUE_LEN
+#define APP_NET_QUEUE_LEN 8
+#endif
+#ifndef APP_UI_MAX_SLEEP_MS
+#define APP_UI_MAX_SLEEP_MS 500  // cap when no LVGL timer is pending
+#endif
+#ifndef APP_NET_POLL_MS
+#define APP_NET_POLL_MS 120      // net poll hook period (telemetry source)
+#endif
+
+// Inbound (to the UI task)
+enum class UiMsgType : uint8_t { KEY=0, TELEMETRY };
+struct Telemetry { uint8_t soundLevel; bool motion; };
+struct UiMsg {
+  UiMsgType type;
+  union { char key; Telemetry tel; };
+};
+
+// Outbound (to the net task): app state changed by the user; the state
+// itself is read with app_model_read(), so drops only coalesce updates
+struct NetMsg { uint32_t version; };
+
+typedef void (*UiMsgFn)(const UiMsg& m);     // runs on the ui task
+typedef void (*NetMsgFn)(const NetMsg& m);   // runs on the net task
+typedef void (*NetPollFn)();                 // net task, every APP_NET_POLL_MS
+
+// Call at the end of setup(); from then on loop() only retires the Arduino task
+bool app_tasks_start(UiMsgFn on_ui, NetMsgFn on_net, NetPollFn net_poll);
+bool app_tasks_running();
+
+bool ui_post(const UiMsg& m);     // any task; false (counted) when the queue is full; wakes ui
+bool net_post(const NetMsg& m);
+
+void ui_wake();                   // any task: run the ui loop now instead of at the next timer
+void ui_wake_from_isr();
+
+void app_tasks_print(Stream& out = Serial);
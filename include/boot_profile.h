@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- Boot profiler / fast boot ----------------------------
+ * boot_mark("stage") timestamps the end of each setup() stage with
+ * esp_timer_get_time(); boot_report() prints absolute and per-stage times
+ * (Serial 'B' reprints it). "first-frame" is the backlight turning on (on the
+ * splash when SPLASH_ENABLE), "ui-frame" the first LVGL frame over it.
+ *
+ * BOOT_FAST=1 (env ws43b_fastboot): no Serial wait, fixed settle delays
+ * replaced by readiness polling, GT911 reset after the backlight, and no
+ * full I2C scan (known devices are probed directly).
+ * ----------------------------------------------------------------------- */
+#ifndef BOOT_FAST
+#define BOOT_FAST 0
+#endif
+#ifndef BOOT_MAX_MARKS
+#define BOOT_MAX_MARKS 24
+#endif
+#ifndef BOOT_BL_SETTLE_MS
+#define BOOT_BL_SETTLE_MS (BOOT_FAST ? 20 : 150)   // one panel refresh is enough once the frame is in PSRAM
+#endif
+
+void boot_mark(const char* stage);      // stage: string literal (pointer is kept)
+void boot_report(Stream& out = Serial);
+
+// Poll ready() every poll_ms until it returns true or timeout_ms passes
+template <typename F>
+bool boot_wait_until(F&& ready, uint32_t timeout_ms, uint32_t poll_ms = 1) {
+  const uint32_t t0 = millis();
+  for (;;) {
+    if (ready()) return true;
+    if (millis() - t0 >= timeout_ms) return false;
+    delay(poll_ms);
+  }
+}
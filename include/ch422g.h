@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- CH422G expander with shadow registers ----------------
+ * The CH422G has no register pointer: each "address" is a command
+ * (0x24 WR_SET, 0x38 WR_IO, 0x26 RD_IO). We keep shadow copies of the
+ * direction and output bytes, stage pin changes, and commit() sends only
+ * what changed: at most one WR_SET + one WR_IO, usually just WR_IO.
+ *
+ * Note: IO0-7 direction is bank-wide in silicon (WR_SET.IO_OE). The bank
+ * is an output while any pin is staged OUTPUT; "INPUT" pins are then held
+ * high (released) in the output byte.
+ * ----------------------------------------------------------------------- */
+#ifndef CH422G_WR_SET
+#define CH422G_WR_SET 0x24
+#endif
+#ifndef CH422G_WR_IO
+#define CH422G_WR_IO  0x38
+#endif
+#ifndef CH422G_RD_IO
+#define CH422G_RD_IO  0x26
+#endif
+
+bool ch422g_begin();                                 // probe + push the initial shadow (all input)
+void ch422g_pin_mode(uint8_t pin, uint8_t mode);     // staged
+void ch422g_write(uint8_t pin, uint8_t level);       // staged
+void ch422g_write_mask(uint8_t mask, uint8_t levels);// staged, several pins at once
+bool ch422g_commit();                                // one bus job; no-op if nothing changed
+bool ch422g_read_inputs(uint8_t& levels);
+uint32_t ch422g_write_count();                       // I2C writes issued (for comparison)
@@ -0,0 +1,112 @@
+#pragma once
+#include <stdint.h>
+#if defined(ARDUINO) || __has_include(<Arduino.h>)
+  #include <Arduino.h>         // target, or the native env's host layer (virtual time)
+  #define CO_HAVE_ARDUINO 1
+#else
+  #define CO_HAVE_ARDUINO 0
+  #include <chrono>
+  #include <thread>
+#endif
+
+/* ---------------- Stackless coroutines for timed device sequences -------
+ * Protothread style: a sequence is a step function
+ *
+ *   CoRc my_seq(CoSeq& co, MyCtx& c) {
+ *     CO_BEGIN(co);
+ *     pin low ...;
+ *     CO_SLEEP_MS(co, 10);                 // yields; resumes here later
+ *     CO_WAIT_UNTIL(co, probe_ok(), 50, 2); // poll every 2 ms, co.timed_out on expiry
+ *     CO_RETURN(co, !co.timed_out);
+ *     CO_END(co);
+ *   }
+ *
+ * Each call runs until the next yield and returns WAIT (call again after
+ * co_wait_ms(co)), DONE or FAIL. Locals do not survive a yield: keep state
+ * in the context. One yield macro per source line (they use __LINE__), and
+ * no yields inside a nested switch. Sub-millisecond waits (bit-banged
+ * pulses) stay inline; only millisecond waits become yields.
+ *
+ * Drivers: co_run_blocking() (setup / bus task, same timing as before),
+ * co_start_lv() (LVGL timer: the UI keeps rendering between steps), or a
+ * caller that steps it itself (i2c_health_service on the bus task).
+ * ----------------------------------------------------------------------- */
+enum class CoRc : uint8_t { WAIT=0, DONE, FAIL };
+
+struct CoSeq {
+  uint16_t pc = 0;          // resume line; 0 = start
+  bool     timed_out = false;
+  bool     ok = false;      // result of the last CO_AWAIT
+  uint32_t wake_ms = 0;
+  uint32_t deadline_ms = 0;
+  void reset() { *this = CoSeq{}; }
+  bool running() const { return pc != 0; }
+};
+
+inline uint32_t co_now_ms() {
+#if CO_HAVE_ARDUINO
+  return millis();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline uint32_t co_wait_ms(const CoSeq& co) {
+  const int32_t left = (int32_t)(co.wake_ms - co_now_ms());
+  return left > 0 ? (uint32_t)left : 0;
+}
+
+#define CO_BEGIN(co)  switch ((co).pc) { case 0:
+
+#define CO_SLEEP_MS(co, ms) do {                                             \
+    (co).wake_ms = co_now_ms() + (ms); (co).pc = __LINE__; [[fallthrough]]; case __LINE__: \
+    if ((int32_t)((co).wake_ms - co_now_ms()) > 0) return CoRc::WAIT;        \
+  } while (0)
+
+#define CO_WAIT_UNTIL(co, cond, timeout_ms, poll_ms) do {                    \
+    (co).deadline_ms = co_now_ms() + (timeout_ms); (co).wake_ms = co_now_ms(); \
+    (co).pc = __LINE__; [[fallthrough]]; case __LINE__:                      \
+    if ((int32_t)((co).wake_ms - co_now_ms()) > 0) return CoRc::WAIT;        \
+    if (cond) { (co).timed_out = false; break; }                             \
+    if ((int32_t)(co_now_ms() - (co).deadline_ms) >= 0) { (co).timed_out = true; break; } \
+    (co).wake_ms = co_now_ms() + (poll_ms); return CoRc::WAIT;               \
+  } while (0)
+
+// Run a child sequence to completion; co.ok = child finished with DONE
+#define CO_AWAIT(co, child, call) do {                                       \
+    (child).reset(); (co).pc = __LINE__; [[fallthrough]]; case __LINE__: {   \
+      const CoRc co_rc_ = (call);                                            \
+      if (co_rc_ == CoRc::WAIT) { (co).wake_ms = (child).wake_ms; return CoRc::WAIT; } \
+      (co).ok = (co_rc_ == CoRc::DONE);                                      \
+    }                                                                        \
+  } while (0)
+
+#define CO_RETURN(co, success) do { (co).pc = 0; return (success) ? CoRc::DONE : CoRc::FAIL; } while (0)
+#define CO_END(co)    } (co).pc = 0; return CoRc::DONE
+
+// Step to completion in the calling context (sleeps between steps)
+template <typename Step>
+bool co_run_blocking(CoSeq& co, Step&& step) {
+  co.reset();
+  for (;;) {
+    const CoRc rc = step(co);
+    if (rc != CoRc::WAIT) return rc == CoRc::DONE;
+    const uint32_t w = co_wait_ms(co);
+#if CO_HAVE_ARDUINO
+    if (w) delay(w);
+#else
+    if (w) std::this_thread::sleep_for(std::chrono::milliseconds(w));
+#endif
+  }
+}
+
+/* LVGL-timer driver (ui task): one timer per running sequence, its period
+   set to each step's wait; done(ctx, ok) runs on the ui task at the end. */
+#ifndef CO_LV_MAX
+#define CO_LV_MAX 4
+#endif
+typedef CoRc (*CoStepFn)(CoSeq& co, void* ctx);
+typedef void (*CoDoneFn)(void* ctx, bool ok);
+
+bool co_start_lv(CoStepFn step, void* ctx, CoDoneFn done = nullptr);   // false: no free slot
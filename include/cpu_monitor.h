@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- CPU / loop-latency monitor ----------------------------
+ * Closed in windows of CPU_MON_PERIOD_MS (cpu_mon_update() from an LVGL
+ * timer):
+ *   - per-task CPU share and per-core idle % from FreeRTOS run-time stats
+ *     (needs CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, off in the stock
+ *     Arduino core; without it per-core idle is sampled at every tick and
+ *     per-task shares are not known)
+ *   - ui loop iteration time (queue drain + lv_timer_handler, sleep
+ *     excluded): p99 and max per window, max since boot
+ * Serial 'u' prints the table, 'U' puts the summary on the diag label.
+ * ----------------------------------------------------------------------- */
+#ifndef CPU_MON_PERIOD_MS
+#define CPU_MON_PERIOD_MS 1000
+#endif
+#ifndef CPU_MON_LOOP_SAMPLES
+#define CPU_MON_LOOP_SAMPLES 512     // per window; later iterations only update max
+#endif
+#ifndef CPU_MON_PANEL
+#define CPU_MON_PANEL 0              // 1: diag label shows the summary from boot
+#endif
+#ifndef CPU_MON_MAX_TASKS
+#define CPU_MON_MAX_TASKS 24
+#endif
+
+struct CpuWindow {
+  bool     have_rt;                  // run-time stats available
+  bool     have_idle;                // per-core idle known (run-time stats or tick sampling)
+  float    idle_pct[2];              // per core
+  float    ui_busy_pct;              // self-timed ui loop work / wall time
+  uint32_t loops;
+  uint32_t loop_p99_us, loop_max_us;
+  uint32_t loop_max_all_us;          // since boot
+};
+
+void cpu_mon_loop_begin();           // ui task: start of an iteration's work
+void cpu_mon_loop_end();             // ui task: before it goes to sleep
+void cpu_mon_update();               // close the window (every CPU_MON_PERIOD_MS)
+
+const CpuWindow& cpu_mon_last();
+uint64_t cpu_mon_busy_us_total();    // ui loop work since boot
+void cpu_mon_format(char* out, size_t n);   // one line for the diag label
+void cpu_mon_print(Stream& out = Serial);
@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+#include "touch_input.h"
+
+/* ---------------- Hardware discovery cache (NVS) -----------------------
+ * What the last boot found: touch IC + address, the CH422G INT/RST
+ * mapping that brought the GT911 up, and the negotiated I2C clock. The
+ * next boot tries exactly that with one targeted probe each and falls
+ * back to full discovery (and a cache update) only if it fails.
+ * ----------------------------------------------------------------------- */
+struct HwCache {
+  TouchIC  touch_ic;      // NONE = nothing cached
+  uint8_t  touch_addr;
+  uint8_t  exio_int;      // 0xFF = no mapping cached
+  uint8_t  exio_rst;
+  uint32_t clock_hz;      // 0 = not negotiated yet
+};
+
+bool           hw_cache_load();          // false if nothing (valid) stored
+const HwCache& hw_cache();
+void           hw_cache_set_touch(TouchIC ic, uint8_t addr);
+void           hw_cache_set_exio(uint8_t exio_int, uint8_t exio_rst);
+void           hw_cache_set_clock(uint32_t hz);
+bool           hw_cache_save();          // writes only if something changed
+void           hw_cache_clear();         // next boot runs full discovery
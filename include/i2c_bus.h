@@ -0,0 +1,110 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <type_traits>
+#include "coseq.h"
+
+/* ---------------- I2C pins / speed (shared by touch + CH422G) --------- */
+#ifndef TOUCH_I2C_SDA
+#define TOUCH_I2C_SDA 8
+#endif
+#ifndef TOUCH_I2C_SCL
+#define TOUCH_I2C_SCL 9
+#endif
+#ifndef TOUCH_I2C_FREQ
+#define TOUCH_I2C_FREQ 100000   // bring-up clock; raised by i2c_clock_negotiate() after detect
+#endif
+
+/* ---------------- Transfer backend ------------------------------------
+ * Register reads/writes go straight to the ESP-IDF I2C driver that Wire
+ * installs on I2C_BUS_PORT (arduino-esp32 2.x / IDF 4.4 legacy driver):
+ * the read lands in the caller's buffer, the bus task sleeps on the
+ * driver's semaphore while the ISR moves bytes, and completion reaches
+ * the client through the bus manager callback / notification.
+ * Cores with the IDF 5 i2c_master driver (legacy driver must not be
+ * mixed in) and non-ESP builds fall back to Wire.
+ * ----------------------------------------------------------------------- */
+#ifndef I2C_BUS_PORT
+#define I2C_BUS_PORT 0           // Wire == I2C_NUM_0
+#endif
+#ifndef I2C_BACKEND_SIM
+#define I2C_BACKEND_SIM 0        // 1: simulated devices (i2c_sim.h) instead of the real bus
+#endif
+#ifndef I2C_BACKEND_IDF
+  #if !I2C_BACKEND_SIM && defined(ESP_PLATFORM) && __has_include(<driver/i2c.h>) && !__has_include(<driver/i2c_master.h>)
+    #define I2C_BACKEND_IDF 1
+  #else
+    #define I2C_BACKEND_IDF 0
+  #endif
+#endif
+#ifndef I2C_XFER_TIMEOUT_MS
+#define I2C_XFER_TIMEOUT_MS 50   // same as Wire's default
+#endif
+
+/* ---------------- Bus manager -----------------------------------------
+ * One task owns Wire. Clients submit jobs with a priority; the task always
+ * runs the highest-priority pending job next (touch > expander > diag) and
+ * reports completion through a callback or by waking the blocked caller.
+ * Before i2c_bus_start() (early setup) jobs simply run inline.
+ * ----------------------------------------------------------------------- */
+#ifndef I2C_BUS_TASK_PRIO
+#define I2C_BUS_TASK_PRIO 3
+#endif
+#ifndef I2C_BUS_TASK_CORE
+#define I2C_BUS_TASK_CORE 0      // keep bus waits off the LVGL core
+#endif
+#ifndef I2C_BUS_STACK
+#define I2C_BUS_STACK 4096
+#endif
+#ifndef I2C_BUS_QUEUE_LEN
+#define I2C_BUS_QUEUE_LEN 8      // per priority
+#endif
+
+enum class I2cPrio   : uint8_t { URGENT=0, NORMAL, BACKGROUND, COUNT };
+enum class I2cClient : uint8_t { TOUCH=0, EXPANDER, DIAG, OTHER, COUNT };
+
+typedef bool (*I2cJobFn)(void* ctx);              // runs on the bus task; returns success
+typedef void (*I2cDoneFn)(void* ctx, bool ok);    // completion, also on the bus task
+
+bool i2c_bus_start();
+bool i2c_bus_submit(I2cClient c, I2cPrio p, I2cJobFn fn, void* ctx, I2cDoneFn done = nullptr);
+bool i2c_bus_run(I2cClient c, I2cPrio p, I2cJobFn fn, void* ctx);   // blocks until done
+bool i2c_bus_in_context();   // true on the bus task (or before start): Wire may be used directly
+TaskHandle_t i2c_bus_task();  // nullptr before i2c_bus_start()
+void i2c_bus_print_stats(Stream& out = Serial);
+
+/* Blocking call of any callable on the bus task, e.g.
+     i2c_bus_call(I2cClient::OTHER, I2cPrio::NORMAL, [&]{ return Wire.setClock(400000); }); */
+template <typename F>
+bool i2c_bus_call(I2cClient c, I2cPrio p, F&& f) {
+  if (i2c_bus_in_context()) return f();
+  using Fn = typename std::remove_reference<F>::type;
+  return i2c_bus_run(c, p, [](void* ctx) -> bool { return (*static_cast<Fn*>(ctx))(); }, (void*)&f);
+}
+
+/* Raw transfers on the selected backend (IDF driver / Wire / simulator).
+   Bus task only: no forwarding, accounting or tracing. reg_len 0 = plain read. */
+enum class I2cRc : uint8_t { OK=0, NACK, TIMEOUT, ERROR };
+I2cRc i2c_raw_probe(uint8_t addr);
+I2cRc i2c_raw_write(uint8_t addr, const uint8_t* pkt, size_t n);
+I2cRc i2c_raw_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len);
+void  i2c_raw_set_clock(uint32_t hz);
+
+/* Register helpers. 8-bit register maps pass a 1-byte reg to i2c_read();
+   16-bit maps (GT911) use the *_block forms (chunked only on the Wire backend).
+   Called from another task they are forwarded to the bus task (OTHER/NORMAL). */
+bool i2c_probe(uint8_t addr);
+void i2c_bus_note(bool ok);   // transfer result -> clock back-off + failure monitor (probes excluded)
+void i2c_bus_nack_expected(uint8_t addr);   // device NACKs while asleep (CST816): its NACKs are not failures
+bool i2c_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len);
+bool i2c_write_u8(uint8_t addr, uint16_t reg, uint8_t v);
+bool i2c_read_block(uint8_t addr, uint16_t reg, uint8_t* buf, size_t len);
+bool i2c_write_block(uint8_t addr, uint16_t reg, const uint8_t* buf, size_t len);
+
+/* Utilities you can call from main for debugging */
+bool i2c_bus_recover(uint8_t sclPin = TOUCH_I2C_SCL, uint8_t sdaPin = TOUCH_I2C_SDA);
+/* Same sequence as a coroutine (coseq.h), bus task only: i2c_health steps it
+   so the bus task sleeps through the settle times instead of delay() */
+CoRc i2c_bus_recover_co(CoSeq& co, uint8_t sclPin = TOUCH_I2C_SCL, uint8_t sdaPin = TOUCH_I2C_SDA);
@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- I2C clock negotiation --------------------------------
+ * Bring-up runs at TOUCH_I2C_FREQ. i2c_clock_negotiate() then tries each
+ * step below against the devices the registry knows are present: address
+ * probes (NACK/timeout) plus repeated ID reads of the touch controller
+ * compared with the value read at the bring-up clock (consistency). The
+ * fastest step with no errors wins.
+ *
+ * At runtime the register helpers report every transfer; if more than
+ * I2C_CLOCK_BACKOFF_ERRS of the last I2C_CLOCK_WINDOW fail, the clock
+ * drops one step (never below the first).
+ * ----------------------------------------------------------------------- */
+#ifndef I2C_CLOCK_STEPS
+#define I2C_CLOCK_STEPS 100000, 400000, 1000000
+#endif
+#ifndef I2C_CLOCK_ROUNDS
+#define I2C_CLOCK_ROUNDS 20          // probe + ID read rounds per step
+#endif
+#ifndef I2C_CLOCK_WINDOW
+#define I2C_CLOCK_WINDOW 256         // transfers per runtime error window
+#endif
+#ifndef I2C_CLOCK_BACKOFF_ERRS
+#define I2C_CLOCK_BACKOFF_ERRS 8     // errors per window that trigger a step down
+#endif
+
+uint32_t i2c_clock_hz();                            // current bus clock
+uint32_t i2c_clock_negotiate(Stream& out = Serial); // returns the chosen clock
+bool     i2c_clock_verify(uint32_t hz, Stream& out = Serial);   // one clean round at a known-good clock -> use it
+void     i2c_clock_note(bool ok);                   // called by the helpers per transfer (bus task)
+void     i2c_clock_print(Stream& out = Serial);
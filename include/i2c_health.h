@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- I2C failure monitor / auto-recovery ------------------
+ * Every helper transfer reports its result (i2c_bus_note), except NACKs
+ * from devices that sleep (i2c_bus_nack_expected). After
+ * I2C_HEALTH_FAIL_RUN consecutive failures (NACK, timeout, stuck SDA) the
+ * bus is declared down: touch sampling stops hammering it and the bus task
+ * runs i2c_bus_recover() plus the registered re-init hook, retrying with
+ * exponential backoff until the device answers again. The recovery is
+ * stepped as a coroutine: the bus task sleeps through its settle times
+ * (holding client jobs back) instead of spinning in delay(). Outage length
+ * is logged and kept for 'b'.
+ * ----------------------------------------------------------------------- */
+#ifndef I2C_HEALTH_FAIL_RUN
+#define I2C_HEALTH_FAIL_RUN 5            // consecutive failed transfers -> outage
+#endif
+#ifndef I2C_HEALTH_BACKOFF_MIN_MS
+#define I2C_HEALTH_BACKOFF_MIN_MS 5      // first retry delay (first attempt is immediate)
+#endif
+#ifndef I2C_HEALTH_BACKOFF_MAX_MS
+#define I2C_HEALTH_BACKOFF_MAX_MS 2000
+#endif
+
+typedef bool (*I2cReinitFn)();           // bus task; true once the device is back
+
+void     i2c_health_note(bool ok);
+bool     i2c_health_ok();                // false during an outage
+bool     i2c_health_busy();              // recovery sequence between steps: run no jobs
+void     i2c_health_service();           // bus task: recovery attempt if one is due
+uint32_t i2c_health_wait_ms();           // time until the next attempt (0 = due / healthy)
+void     i2c_health_on_recover(I2cReinitFn fn);
+void     i2c_health_print(Stream& out = Serial);
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+#include "i2c_bus.h"
+
+/* ---------------- I2C device registry ----------------------------------
+ * One full 126-address scan at boot (or on an explicit diagnostic rescan)
+ * fills a presence map; after that only the known devices below are
+ * probed, one address each. Fast boot skips the scan entirely and the
+ * known devices are found by those targeted probes. The UI scan box
+ * renders from the registry.
+ *
+ *   0x24 CH422G (WR_SET; the chip also ACKs its other command addresses)
+ *   0x5D / 0x14 GT911,  0x38 FT6x36 (or CH422G WR_IO),  0x15 CST816
+ * ----------------------------------------------------------------------- */
+struct I2cKnownDevice {
+  uint8_t     addr;
+  const char* name;
+  bool        present;      // seen by the last full scan
+  bool        alive;        // result of the last targeted probe
+  uint32_t    checked_ms;   // millis() of that probe (0 = never)
+};
+
+void   i2c_registry_scan();                       // full scan (DIAG/BACKGROUND job)
+bool   i2c_registry_scanned();
+bool   i2c_registry_present(uint8_t addr);        // from the last full scan
+bool   i2c_registry_check(uint8_t addr);          // targeted probe, updates liveness
+void   i2c_registry_check_known();                // probe every known device that was present
+const  I2cKnownDevice* i2c_registry_known(size_t& count);
+size_t i2c_registry_format(char* buf, size_t len, const char* tag);   // scan-box text
+void   i2c_registry_print(Stream& out = Serial);
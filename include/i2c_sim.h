@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/* ---------------- Simulated I2C bus + device models --------------------
+ * Plain C++ (no Arduino), so it builds on the host as well as on target
+ * (I2C_BACKEND_SIM=1 routes the raw transfer layer in i2c_bus.cpp here).
+ *
+ *   GT911   16-bit register pointer; config 0x8047..0x8100 with checksum
+ *           + Config_Fresh semantics, product ID "911" at 0x8140, status
+ *           0x814E (buffer-ready until the host writes 0), points 0x8150.
+ *           Address latched at reset from INT (low -> 0x5D, high -> 0x14).
+ *   FT6x36  8-bit pointer; TD_STATUS 0x02, P1 0x03..0x06, CHIPID 0xA8,
+ *           VENDID 0xA3.
+ *   CH422G  command addresses 0x24 WR_SET, 0x38 WR_IO, 0x26 RD_IO; its
+ *           IO pins can drive the GT911 INT/RST lines.
+ *
+ * Faults: NACK every Nth transfer to an address, stuck SDA (released after
+ * N recovery clock pulses), added latency per transfer. Bus time is
+ * accumulated virtually from the byte count and clock, so benchmarks are
+ * not bound by real time unless a delay hook is installed.
+ * ----------------------------------------------------------------------- */
+enum class I2cSimRc : uint8_t { OK=0, NACK, TIMEOUT };
+
+struct I2cSimStats {
+  uint32_t transfers, nacks, timeouts, bytes;
+  uint64_t bus_time_us;            // virtual: bits / clock + injected latency
+};
+
+void i2c_sim_reset();                                   // no devices, no faults, 100 kHz
+void i2c_sim_add_gt911(uint8_t addr = 0x5D);
+void i2c_sim_add_ft6x36();                              // 0x38 (don't combine with CH422G)
+void i2c_sim_add_ch422g();
+void i2c_sim_wire_gt911_reset(uint8_t exio_int, uint8_t exio_rst);   // CH422G pins -> GT911
+
+// Finger on the panel (raw controller coordinates) for the touch models
+void i2c_sim_touch(bool pressed, uint16_t x = 0, uint16_t y = 0);
+void i2c_sim_ch422g_inputs(uint8_t levels);            // what RD_IO returns for input pins
+
+// Transfers. wn = 0: plain read; rn = 0: plain write; both: write + repeated start + read
+I2cSimRc i2c_sim_xfer(uint8_t addr, const uint8_t* w, size_t wn, uint8_t* r, size_t rn);
+void     i2c_sim_set_clock(uint32_t hz);
+bool     i2c_sim_clock_pulses(unsigned n);             // recovery: true once SDA reads high
+
+// Faults
+void i2c_sim_fault_nack(uint8_t addr, uint16_t every_n);    // 0 = off, 1 = always
+void i2c_sim_fault_stuck_sda(uint16_t release_after_pulses); // 0 = off
+void i2c_sim_fault_latency(uint32_t us);
+void i2c_sim_set_delay_fn(void (*fn)(uint32_t us));         // real-time latency (optional)
+
+const I2cSimStats& i2c_sim_stats();
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- I2C transaction tracer (opt-in) ----------------------
+ * Off by default; i2c_trace_enable(true) (Serial 'D') starts recording
+ * every helper transfer (probe / read / write / CH422G command) into a
+ * RAM ring: address, register, length, result, start time, duration.
+ * Per device it keeps count, errors, total bus time and a log2 duration
+ * histogram, so the dump shows how much of each second (and frame) the
+ * bus spends on touch vs. expander vs. diagnostics.
+ * ----------------------------------------------------------------------- */
+#ifndef I2C_TRACE_DEPTH
+#define I2C_TRACE_DEPTH 512          // ring entries (16 bytes each)
+#endif
+#ifndef I2C_TRACE_DEVICES
+#define I2C_TRACE_DEVICES 8          // distinct addresses with histograms
+#endif
+#ifndef I2C_TRACE_DUMP_LAST
+#define I2C_TRACE_DUMP_LAST 32       // ring entries printed by the dump
+#endif
+
+enum class I2cOp : uint8_t { PROBE=0, READ, WRITE, EXIO };
+
+void i2c_trace_enable(bool on);      // enabling clears previous data
+bool i2c_trace_enabled();
+void i2c_trace_record(I2cOp op, uint8_t addr, uint16_t reg, uint16_t len, bool ok, uint32_t t0_us);
+void i2c_trace_dump(Stream& out = Serial);
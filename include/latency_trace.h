@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/* ---------------- Touch-to-photon latency tracing ----------------------
+ * Follows an input sample through the pipeline:
+ *   sample   touch_read_cb read the controller      lat_input_sample()
+ *   event    app handler ran (on_play, on_volume)   lat_event(obj)
+ *   render   LVGL started rendering the frame       (display event)
+ *   flush    the area covering obj hit the panel    lat_flush(area)
+ * and reports p50/p95/p99 per stage over the session.
+ * ----------------------------------------------------------------------- */
+#ifndef LAT_MAX_SAMPLES
+#define LAT_MAX_SAMPLES 512       // completed traces kept for percentiles (ring)
+#endif
+#ifndef LAT_PENDING_TIMEOUT_US
+#define LAT_PENDING_TIMEOUT_US 500000   // event never reached a flush -> dropped
+#endif
+
+void lat_attach(lv_display_t* disp);          // hooks render start on this display
+void lat_input_sample(uint32_t t_us);         // time the sample was read (micros())
+void lat_event(const lv_obj_t* affected);     // handler ran; obj = area whose pixels change
+void lat_flush(const lv_area_t* area);        // call from flush_cb once pixels are written
+void lat_report(Stream& out = Serial);
+void lat_reset();
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+/* ---------------- Power management (DFS + light sleep) ------------------
+ * With CONFIG_PM_ENABLE (custom sdkconfig; the stock Arduino core ships
+ * without it) pm_init() lets ESP-IDF drop the CPU to PM_MIN_MHZ and enter
+ * automatic light sleep whenever no lock is held. The app holds locks only
+ * while work is running:
+ *   RENDER  ui loop iteration (queue drain, LVGL timers, render, flush)
+ *   I2C     one bus-manager job (the IDF I2C driver adds its own APB lock)
+ * The RGB panel driver keeps its own APB lock while scanning out, so with
+ * the panel running only DFS takes effect; light sleep needs the panel off.
+ *
+ * Without CONFIG_PM_ENABLE the lock calls are bookkeeping only: 'P' still
+ * reports how long each lock was held, i.e. the share of time the CPU has
+ * to run at full clock.
+ * ----------------------------------------------------------------------- */
+#ifndef PM_MAX_MHZ
+#define PM_MAX_MHZ 240
+#endif
+#ifndef PM_MIN_MHZ
+#define PM_MIN_MHZ 80            // keeps APB at 80 MHz (RGB PCLK / I2C timing)
+#endif
+#ifndef PM_LIGHT_SLEEP
+#define PM_LIGHT_SLEEP 1
+#endif
+
+enum class PmLock : uint8_t { RENDER=0, I2C, COUNT };
+
+bool pm_init();                  // false: DFS not available in this build (locks still counted)
+bool pm_active();
+void pm_lock(PmLock l);          // not nestable per lock; one owner task each
+void pm_unlock(PmLock l);
+void pm_print(Stream& out = Serial);   // per-lock held duty since boot / last 'P'
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include "app_model.h"
+
+/* ---------------- Warm-restart snapshot (RTC slow memory) ---------------
+ * The app model and the screen state are copied into RTC_NOINIT memory on
+ * every change. That memory survives software/panic/watchdog resets and
+ * deep sleep, but not power-on. Two slots are written alternately, each
+ * with a sequence number and CRC-32, so a reset in the middle of a write
+ * still leaves the previous snapshot intact.
+ *
+ * On a warm reset with a valid snapshot, setup() restores the model and
+ * screen before the UI is built, and takes the quick boot path: no Serial
+ * wait, no full I2C scan. The GT911 reset is skipped only after a software
+ * restart or deep sleep; after a panic or watchdog the bus may have been cut
+ * mid-transfer, so the controller is reset as on a fast boot.
+ *
+ * A snapshot that crashes the firmware must not be restored forever: warm
+ * boots are counted in RTC memory, and after RTC_WARM_MAX in a row without
+ * RTC_WARM_STABLE_MS of uptime in between the boot goes cold.
+ * ----------------------------------------------------------------------- */
+#ifndef RTC_WARM_MAX
+#define RTC_WARM_MAX 3
+#endif
+#ifndef RTC_WARM_STABLE_MS
+#define RTC_WARM_STABLE_MS 30000
+#endif
+
+enum class RtcScreen : uint8_t { MAIN=0, MAIN_DARK };
+
+bool rtc_state_restore(AppModel& m, RtcScreen& screen);   // true: warm reset + valid snapshot
+void rtc_state_save(const AppModel& m, RtcScreen screen);  // ui task (single writer)
+bool rtc_state_warm();                                     // result of the last restore
+uint32_t rtc_state_dropped_run();                          // >0: the last restore broke a crash loop of this many warm boots
+bool rtc_state_soft_reset();                               // software restart / deep sleep: peripherals were idle
+void rtc_state_boot_ok();                                  // up RTC_WARM_STABLE_MS: clears the warm-boot run
+void rtc_state_print(Stream& out = Serial);
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/* ---------------- Screen sleep -----------------------------------------
+ * screen_sleep(): backlight off, LVGL invalidation disabled and the
+ * display refresh timer paused. Widgets keep taking model updates, but
+ * nothing is rendered or flushed. Touch stays in idle polling (INT-only when
+ * TOUCH_INT_PIN is wired); the first press wakes the screen and is not
+ * delivered to widgets.
+ * screen_wake(): one full-screen refresh into the framebuffer, backlight on
+ * when it is done (LV_EVENT_REFR_READY).
+ *
+ * Auto sleep after SCREEN_SLEEP_AFTER_MS without input (0 = manual, 'z');
+ * SCREEN_WAKE_ON_CRY lights the screen when a cry is detected.
+ * 'Z' compares flushes, pixels written to the PSRAM framebuffer and ui loop
+ * CPU per second between the lit and dark states. The RGB DMA keeps
+ * scanning the framebuffer out of PSRAM while dark; that read traffic
+ * is not saved.
+ * ----------------------------------------------------------------------- */
+#ifndef SCREEN_SLEEP_AFTER_MS
+#define SCREEN_SLEEP_AFTER_MS 0
+#endif
+#ifndef SCREEN_WAKE_ON_CRY
+#define SCREEN_WAKE_ON_CRY 1
+#endif
+
+typedef void (*BacklightFn)(bool on);
+typedef void (*ScreenChangeFn)(bool dark);
+
+void screen_power_init(lv_display_t* disp, BacklightFn backlight, ScreenChangeFn on_change = nullptr);
+void screen_sleep();
+void screen_wake();             // ui task (LVGL context)
+bool screen_asleep();
+void screen_note_flush(uint32_t px);   // from the flush callback
+void screen_power_print(Stream& out = Serial);
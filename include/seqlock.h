@@ -0,0 +1,61 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+/* ---------------- Seqlock snapshot -------------------------------------
+ * One versioned copy of a small trivially-copyable T. Writers never wait
+ * for readers; readers never block writers and retry if a write overlapped
+ * their copy (odd sequence, or sequence changed). The payload lives in
+ * relaxed atomic words, so a torn copy is only ever discarded, never UB.
+ *
+ * Writers are serialized by a spin flag (the UI task is the only regular
+ * writer, so it is uncontended). Plain C++ (no Arduino), host-buildable.
+ * ----------------------------------------------------------------------- */
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock<T>: T must be trivially copyable");
+  static constexpr size_t WORDS = (sizeof(T) + 3) / 4;
+
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<uint32_t> w_[WORDS] = {};
+  std::atomic_flag      writer_ = ATOMIC_FLAG_INIT;
+
+public:
+  void store(const T& v) {
+    uint32_t buf[WORDS] = {};
+    memcpy(buf, &v, sizeof(T));
+    while (writer_.test_and_set(std::memory_order_acquire)) { }
+    const uint32_t s = seq_.load(std::memory_order_relaxed);
+    seq_.store(s + 1, std::memory_order_relaxed);          // odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i) w_[i].store(buf[i], std::memory_order_relaxed);
+    seq_.store(s + 2, std::memory_order_release);
+    writer_.clear(std::memory_order_release);
+  }
+
+  // One attempt; false if a write overlapped (out untouched)
+  bool try_load(T& out, uint32_t* version = nullptr) const {
+    uint32_t buf[WORDS];
+    const uint32_t s0 = seq_.load(std::memory_order_acquire);
+    if (s0 & 1u) return false;
+    for (size_t i = 0; i < WORDS; ++i) buf[i] = w_[i].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (seq_.load(std::memory_order_relaxed) != s0) return false;
+    memcpy(&out, buf, sizeof(T));
+    if (version) *version = s0 >> 1;
+    return true;
+  }
+
+  // Retries until consistent; *retries counts discarded attempts
+  T load(uint32_t* version = nullptr, uint32_t* retries = nullptr) const {
+    T v;
+    uint32_t n = 0;
+    while (!try_load(v, version)) ++n;
+    if (retries) *retries += n;
+    return v;
+  }
+
+  uint32_t version() const { return seq_.load(std::memory_order_acquire) >> 1; }   // completed writes
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+/* ---------------- Boot splash (flash-resident) --------------------------
+ * A pre-rendered 800x480 RGB565 frame, RLE-compressed into flash
+ * (include/splash_image.h, regenerate with tools/make_splash.py). It is
+ * decoded straight into the RGB panel framebuffer right after
+ * gfx->begin(), so the backlight can come on before lv_init(); LVGL's
+ * first refresh later paints over it.
+ * ----------------------------------------------------------------------- */
+#ifndef SPLASH_ENABLE
+#define SPLASH_ENABLE 1
+#endif
+#ifndef SPLASH_SETTLE_MS
+#define SPLASH_SETTLE_MS 35    // one full panel scan at 16 MHz PCLK before BL on
+#endif
+
+// Decode into fb (w x h, RGB565) and write the CPU cache back to PSRAM.
+// false (fb untouched) if fb is null or the image doesn't match w x h.
+bool splash_draw(uint16_t* fb, uint16_t w, uint16_t h);
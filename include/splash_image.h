@@ -0,0 +1,333 @@
+#pragma once
+#include <stdint.h>
+
+// Generated by tools/make_splash.py -- do not edit
+// 800x480 RGB565, 1942 runs (7768 bytes vs 768000 raw)
+static constexpr uint16_t SPLASH_W = 800, SPLASH_H = 480;
+static constexpr uint32_t SPLASH_RUNS = 1942;
+static const uint16_t kSplashRle[SPLASH_RUNS * 2] = {
+  65535,0x0000, 2755,0x0000, 1,0xFFE0, 796,0x0000, 7,0xFFE0, 792,0x0000,
+  9,0xFFE0, 791,0x0000, 9,0xFFE0, 791,0x0000, 9,0xFFE0, 790,0x0000,
+  11,0xFFE0, 790,0x0000, 9,0xFFE0, 791,0x0000, 9,0xFFE0, 88,0x0000,
+  4,0xFF74, 699,0x0000, 9,0xFFE0, 84,0x0000, 7,0xFF74, 701,0x0000,
+  7,0xFFE0, 82,0x0000, 9,0xFF74, 705,0x0000, 1,0xFFE0, 82,0x0000,
+  11,0xFF74, 786,0x0000, 14,0xFF74, 784,0x0000, 15,0xFF74, 783,0x0000,
+  16,0xFF74, 782,0x0000, 17,0xFF74, 781,0x0000, 19,0xFF74, 779,0x0000,
+  20,0xFF74, 778,0x0000, 21,0xFF74, 778,0x0000, 22,0xFF74, 776,0x0000,
+  23,0xFF74, 162,0x0000, 1,0xFFE0, 613,0x0000, 24,0xFF74, 159,0x0000,
+  7,0xFFE0, 608,0x0000, 25,0xFF74, 159,0x0000, 9,0xFFE0, 606,0x0000,
+  26,0xFF74, 158,0x0000, 11,0xFFE0, 604,0x0000, 26,0xFF74, 159,0x0000,
+  11,0xFFE0, 603,0x0000, 27,0xFF74, 159,0x0000, 11,0xFFE0, 602,0x0000,
+  27,0xFF74, 159,0x0000, 13,0xFFE0, 599,0x0000, 29,0xFF74, 160,0x0000,
+  11,0xFFE0, 599,0x0000, 29,0xFF74, 161,0x0000, 11,0xFFE0, 598,0x0000,
+  30,0xFF74, 161,0x0000, 11,0xFFE0, 597,0x0000, 30,0xFF74, 163,0x0000,
+  9,0xFFE0, 597,0x0000, 31,0xFF74, 164,0x0000, 7,0xFFE0, 597,0x0000,
+  32,0xFF74, 167,0x0000, 1,0xFFE0, 600,0x0000, 31,0xFF74, 768,0x0000,
+  32,0xFF74, 767,0x0000, 33,0xFF74, 766,0x0000, 33,0xFF74, 766,0x0000,
+  34,0xFF74, 765,0x0000, 35,0xFF74, 765,0x0000, 35,0xFF74, 764,0x0000,
+  35,0xFF74, 764,0x0000, 36,0xFF74, 764,0x0000, 36,0xFF74, 763,0x0000,
+  37,0xFF74, 762,0x0000, 38,0xFF74, 762,0x0000, 37,0xFF74, 762,0x0000,
+  38,0xFF74, 762,0x0000, 38,0xFF74, 761,0x0000, 39,0xFF74, 761,0x0000,
+  39,0xFF74, 760,0x0000, 40,0xFF74, 760,0x0000, 40,0xFF74, 759,0x0000,
+  41,0xFF74, 759,0x0000, 41,0xFF74, 758,0x0000, 42,0xFF74, 758,0x0000,
+  42,0xFF74, 757,0x0000, 42,0xFF74, 758,0x0000, 43,0xFF74, 757,0x0000,
+  43,0xFF74, 756,0x0000, 44,0xFF74, 756,0x0000, 44,0xFF74, 756,0x0000,
+  44,0xFF74, 755,0x0000, 45,0xFF74, 755,0x0000, 45,0xFF74, 241,0x0000,
+  1,0xFFE0, 513,0x0000, 45,0xFF74, 239,0x0000, 5,0xFFE0, 510,0x0000,
+  46,0xFF74, 239,0x0000, 5,0xFFE0, 510,0x0000, 46,0xFF74, 238,0x0000,
+  7,0xFFE0, 509,0x0000, 46,0xFF74, 239,0x0000, 5,0xFFE0, 510,0x0000,
+  47,0xFF74, 238,0x0000, 5,0xFFE0, 509,0x0000, 48,0xFF74, 240,0x0000,
+  1,0xFFE0, 511,0x0000, 48,0xFF74, 752,0x0000, 48,0xFF74, 752,0x0000,
+  48,0xFF74, 752,0x0000, 49,0xFF74, 750,0x0000, 50,0xFF74, 750,0x0000,
+  50,0xFF74, 750,0x0000, 50,0xFF74, 750,0x0000, 51,0xFF74, 749,0x0000,
+  51,0xFF74, 749,0x0000, 51,0xFF74, 749,0x0000, 52,0xFF74, 748,0x0000,
+  52,0xFF74, 748,0x0000, 52,0xFF74, 748,0x0000, 53,0xFF74, 747,0x0000,
+  53,0xFF74, 747,0x0000, 54,0xFF74, 745,0x0000, 55,0xFF74, 746,0x0000,
+  55,0xFF74, 745,0x0000, 55,0xFF74, 745,0x0000, 56,0xFF74, 744,0x0000,
+  56,0xFF74, 744,0x0000, 57,0xFF74, 743,0x0000, 57,0xFF74, 743,0x0000,
+  58,0xFF74, 742,0x0000, 58,0xFF74, 742,0x0000, 59,0xFF74, 741,0x0000,
+  60,0xFF74, 740,0x0000, 60,0xFF74, 740,0x0000, 61,0xFF74, 740,0x0000,
+  61,0xFF74, 739,0x0000, 62,0xFF74, 738,0x0000, 62,0xFF74, 738,0x0000,
+  63,0xFF74, 737,0x0000, 64,0xFF74, 737,0x0000, 64,0xFF74, 736,0x0000,
+  65,0xFF74, 735,0x0000, 66,0xFF74, 734,0x0000, 67,0xFF74, 734,0x0000,
+  67,0xFF74, 733,0x0000, 68,0xFF74, 732,0x0000, 69,0xFF74, 732,0x0000,
+  69,0xFF74, 731,0x0000, 70,0xFF74, 185,0x0000, 1,0xFFE0, 544,0x0000,
+  72,0xFF74, 181,0x0000, 5,0xFFE0, 543,0x0000, 72,0xFF74, 179,0x0000,
+  7,0xFFE0, 542,0x0000, 73,0xFF74, 178,0x0000, 7,0xFFE0, 542,0x0000,
+  75,0xFF74, 175,0x0000, 9,0xFFE0, 542,0x0000, 75,0xFF74, 175,0x0000,
+  7,0xFFE0, 543,0x0000, 77,0xFF74, 173,0x0000, 7,0xFFE0, 544,0x0000,
+  78,0xFF74, 172,0x0000, 5,0xFFE0, 545,0x0000, 80,0xFF74, 172,0x0000,
+  1,0xFFE0, 548,0x0000, 81,0xFF74, 61,0x0000, 1,0xFF74, 657,0x0000,
+  83,0xFF74, 57,0x0000, 3,0xFF74, 578,0x0000, 1,0xFFE0, 79,0x0000,
+  84,0xFF74, 53,0x0000, 4,0xFF74, 577,0x0000, 5,0xFFE0, 77,0x0000,
+  87,0xFF74, 47,0x0000, 7,0xFF74, 577,0x0000, 5,0xFFE0, 78,0x0000,
+  89,0xFF74, 41,0x0000, 9,0xFF74, 577,0x0000, 7,0xFFE0, 77,0x0000,
+  93,0xFF74, 33,0x0000, 13,0xFF74, 578,0x0000, 5,0xFFE0, 79,0x0000,
+  97,0xFF74, 23,0x0000, 17,0xFF74, 579,0x0000, 5,0xFFE0, 79,0x0000,
+  108,0xFF74, 1,0x0000, 28,0xFF74, 581,0x0000, 1,0xFFE0, 82,0x0000,
+  135,0xFF74, 666,0x0000, 133,0xFF74, 667,0x0000, 133,0xFF74, 668,0x0000,
+  131,0xFF74, 670,0x0000, 129,0xFF74, 671,0x0000, 129,0xFF74, 672,0x0000,
+  127,0xFF74, 674,0x0000, 125,0xFF74, 676,0x0000, 123,0xFF74, 678,0x0000,
+  121,0xFF74, 680,0x0000, 119,0xFF74, 681,0x0000, 119,0xFF74, 682,0x0000,
+  117,0xFF74, 684,0x0000, 115,0xFF74, 686,0x0000, 113,0xFF74, 688,0x0000,
+  111,0xFF74, 690,0x0000, 109,0xFF74, 693,0x0000, 105,0xFF74, 696,0x0000,
+  103,0xFF74, 698,0x0000, 101,0xFF74, 700,0x0000, 99,0xFF74, 702,0x0000,
+  97,0xFF74, 705,0x0000, 93,0xFF74, 708,0x0000, 91,0xFF74, 711,0x0000,
+  87,0xFF74, 714,0x0000, 85,0xFF74, 717,0x0000, 81,0xFF74, 721,0x0000,
+  77,0xFF74, 725,0x0000, 73,0xFF74, 729,0x0000, 69,0xFF74, 733,0x0000,
+  65,0xFF74, 737,0x0000, 61,0xFF74, 742,0x0000, 55,0xFF74, 748,0x0000,
+  49,0xFF74, 754,0x0000, 43,0xFF74, 761,0x0000, 35,0xFF74, 770,0x0000,
+  25,0xFF74, 787,0x0000, 1,0xFF74, 39786,0x0000, 24,0xFFFF, 18,0x0000,
+  18,0xFFFF, 12,0x0000, 24,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 42,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 6,0x0000, 30,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000,
+  24,0xFFFF, 380,0x0000, 24,0xFFFF, 18,0x0000, 18,0xFFFF, 12,0x0000,
+  24,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 30,0xFFFF, 6,0x0000,
+  30,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000, 24,0xFFFF, 380,0x0000,
+  24,0xFFFF, 18,0x0000, 18,0xFFFF, 12,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 30,0xFFFF, 6,0x0000, 30,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 24,0xFFFF, 380,0x0000, 24,0xFFFF, 18,0x0000,
+  18,0xFFFF, 12,0x0000, 24,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 42,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 6,0x0000, 30,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000,
+  24,0xFFFF, 380,0x0000, 24,0xFFFF, 18,0x0000, 18,0xFFFF, 12,0x0000,
+  24,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 30,0xFFFF, 6,0x0000,
+  30,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000, 24,0xFFFF, 380,0x0000,
+  24,0xFFFF, 18,0x0000, 18,0xFFFF, 12,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 12,0x0000, 18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 30,0xFFFF, 6,0x0000, 30,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 24,0xFFFF, 380,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 42,0x0000, 12,0xFFFF, 6,0x0000, 12,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 12,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000,
+  12,0xFFFF, 6,0x0000, 12,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 12,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000, 12,0xFFFF, 6,0x0000,
+  12,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  12,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 42,0x0000, 12,0xFFFF, 6,0x0000, 12,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 12,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000,
+  12,0xFFFF, 6,0x0000, 12,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 12,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 42,0x0000, 12,0xFFFF, 6,0x0000,
+  12,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  12,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 48,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 48,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 12,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 48,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 48,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 48,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 374,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 12,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 48,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  30,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000,
+  12,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 380,0x0000,
+  24,0xFFFF, 12,0x0000, 30,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 12,0x0000, 12,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  24,0xFFFF, 380,0x0000, 24,0xFFFF, 12,0x0000, 30,0xFFFF, 6,0x0000,
+  24,0xFFFF, 24,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000, 12,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 24,0xFFFF, 380,0x0000, 24,0xFFFF, 12,0x0000,
+  30,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000,
+  12,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 380,0x0000,
+  24,0xFFFF, 12,0x0000, 30,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 12,0x0000, 12,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  24,0xFFFF, 380,0x0000, 24,0xFFFF, 12,0x0000, 30,0xFFFF, 6,0x0000,
+  24,0xFFFF, 24,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000, 12,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 24,0xFFFF, 380,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 386,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 386,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 386,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 386,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 386,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 386,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000, 6,0xFFFF, 380,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000,
+  6,0xFFFF, 380,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 12,0x0000, 6,0xFFFF, 380,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000, 6,0xFFFF, 380,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 12,0x0000,
+  6,0xFFFF, 380,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000,
+  6,0xFFFF, 6,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 30,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  6,0xFFFF, 12,0x0000, 6,0xFFFF, 380,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 374,0x0000, 24,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000, 24,0xFFFF, 24,0x0000,
+  6,0xFFFF, 54,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 12,0x0000,
+  18,0xFFFF, 12,0x0000, 6,0xFFFF, 18,0x0000, 6,0xFFFF, 6,0x0000,
+  30,0xFFFF, 18,0x0000, 6,0xFFFF, 24,0x0000, 18,0xFFFF, 12,0x0000,
+  6,0xFFFF, 18,0x0000, 6,0xFFFF, 46887,0x0000, 200,0x3186, 600,0x0000,
+  200,0x3186, 600,0x0000, 200,0x3186, 600,0x0000, 200,0x3186, 600,0x0000,
+  200,0x3186, 600,0x0000, 200,0x3186, 59500,0x0000,
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+#include "touch_input.h"
+
+/* ---------------- Touch calibration (affine, NVS-backed) ---------------
+ * A 3- or 5-point target screen collects raw controller points, fits a
+ * full affine matrix (least squares for 5 points) and hands it to the
+ * touch read path as a Q16 TouchAffine. Stored in NVS so panel batches
+ * no longer need a rebuild with different TOUCH_* offsets.
+ * ----------------------------------------------------------------------- */
+#ifndef TOUCH_CALIB_MAX_RESIDUAL_PX
+#define TOUCH_CALIB_MAX_RESIDUAL_PX 12   // reject fits worse than this (5-point only)
+#endif
+
+bool touch_calib_start(uint8_t points = 5);   // 3 or 5; returns false if no touch
+bool touch_calib_active();
+bool touch_calib_load();                      // NVS -> touch_set_affine(); false if none stored
+bool touch_calib_save(const TouchAffine& m);
+void touch_calib_clear();                     // forget NVS, back to compile-time defaults
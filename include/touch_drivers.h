@@ -0,0 +1,229 @@
+#pragma once
+#include <Arduino.h>
+#include "i2c_registry.h"
+#include "touch_input.h"
+
+/* ---------------- Touch driver interface -------------------------------
+ * Static (compile-time) interface; touch_input.cpp instantiates its read
+ * callback once per driver, so nothing switches on the IC per sample.
+ *
+ *   struct XxxDriver {
+ *     static constexpr TouchIC     IC;
+ *     static constexpr const char* NAME;
+ *     static bool probe(uint8_t& addr);   // identify on the bus (logs), fill address
+ *     static bool begin(uint8_t addr);    // bring-up after a successful probe
+ *     static bool read(TouchPoint& p);    // true + raw controller point while pressed
+ *   };
+ *
+ * CST328 (16-bit register map at 0xD000) would slot in the same way.
+ * ----------------------------------------------------------------------- */
+struct TouchPoint { int16_t x, y; };
+
+// --- Optional GT911 library; compile even if it's missing ---
+#if __has_include(<GT911.h>)
+  #include <GT911.h>
+  #define HAVE_GT911_LIB 1
+#else
+  #define HAVE_GT911_LIB 0
+#endif
+
+/* ---------------- FT6x36 (Adafruit FT6206 lib for bring-up) ----------- */
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_FT6X36
+#if !I2C_BACKEND_SIM
+#include <Adafruit_FT6206.h>
+#endif
+
+struct Ft6x36Driver {
+  static constexpr TouchIC     IC   = TouchIC::FT6X36;
+  static constexpr const char* NAME = "FT6x36";
+  static constexpr uint8_t     ADDR = 0x38;
+#if !I2C_BACKEND_SIM
+  static inline Adafruit_FT6206 ft;
+#endif
+
+  static bool probe(uint8_t& addr) {
+    if (!i2c_registry_check(ADDR)) return false;
+    // Extra sanity: CH422G also ACKs 0x38 (its IO write command); quick ID read (best-effort)
+    uint8_t chip = 0, vend = 0;
+    uint8_t regc[1] = { 0xA8 }; // CHIPID
+    uint8_t regv[1] = { 0xA3 }; // VENDID
+    if (i2c_read(ADDR, regc, 1, &chip, 1) && i2c_read(ADDR, regv, 1, &vend, 1)) {
+      Serial.printf("[touch][FT] CHIPID=0x%02X VENDID=0x%02X\n", chip, vend);
+      if (chip == 0x06 || chip == 0x36) { addr = ADDR; return true; }
+    }
+    Serial.println(F("[touch][FT] 0x38 ACKed but IDs not FT → ignoring"));
+    return false;
+  }
+#if I2C_BACKEND_SIM
+  static bool begin(uint8_t) { return true; }   // library setup goes through Wire; the model needs none
+#else
+  static bool begin(uint8_t) { return ft.begin(30); }
+#endif
+  // TD_STATUS + P1 through the bus helpers (not ft.touched()/getPoint()), so a
+  // failed transfer is accounted and reaches the failure monitor
+  static bool read(TouchPoint& p) {
+    uint8_t b[5], reg[1] = { 0x02 };      // TD_STATUS, P1_XH, P1_XL, P1_YH, P1_YL
+    if (!i2c_read(ADDR, reg, 1, b, sizeof(b)) || (b[0] & 0x0F) == 0) return false;
+    p.x = int16_t(((b[1] & 0x0F) << 8) | b[2]);
+    p.y = int16_t(((b[3] & 0x0F) << 8) | b[4]);
+    return true;
+  }
+};
+#endif
+
+/* ---------------- GT911 (raw I2C, optional library) ------------------- */
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_GT911
+// GT911 minimal raw map
+static constexpr uint16_t GT_REG_PRODUCT_ID = 0x8140; // 4 bytes ASCII
+static constexpr uint16_t GT_REG_STATUS     = 0x814E; // [7]=buf ready, [3:0]=points
+static constexpr uint16_t GT_REG_POINTS     = 0x8150; // first point block
+
+struct GTPointRaw {
+  uint16_t x;
+  uint16_t y;
+  uint16_t size;
+  uint8_t  id;
+  uint8_t  reserved;
+} __attribute__((packed));
+
+struct Gt911Driver {
+  static constexpr TouchIC     IC   = TouchIC::GT911;
+  static constexpr const char* NAME = "GT911";
+  static inline uint8_t addr_ = 0x5D;
+  static inline bool using_lib = false;
+#if HAVE_GT911_LIB
+  static inline GT911 gt;
+#endif
+
+  static bool probe(uint8_t& addr) {
+    bool has_5d = i2c_registry_check(0x5D);
+    bool has_14 = !has_5d && i2c_registry_check(0x14);
+    if (!has_5d && !has_14) return false;
+    addr = addr_ = has_5d ? 0x5D : 0x14;
+    Serial.printf("[touch] GT911 selected @ 0x%02X\n", addr);
+
+    // Product ID read
+    uint8_t idbuf[4] = {0};
+    if (i2c_read_block(addr, GT_REG_PRODUCT_ID, idbuf, 4)) {
+      Serial.printf("[touch][GT] Product ID: %c%c%c%c\n", idbuf[0], idbuf[1], idbuf[2], idbuf[3]);
+    }
+
+    // Resolution read (0x8048 little-endian X, 0x804A little-endian Y); reprogrammed by touch_gt911_config_sync()
+    uint8_t cfg[7] = {0};
+    if (i2c_read_block(addr, 0x8047, cfg, sizeof(cfg))) {
+      uint16_t x = (uint16_t)cfg[1] | ((uint16_t)cfg[2] << 8);
+      uint16_t y = (uint16_t)cfg[3] | ((uint16_t)cfg[4] << 8);
+      Serial.printf("[touch][GT] cfg (raw): ver='%c' %u x %u\n", cfg[0], x, y);
+    }
+    return true;
+  }
+
+  static bool begin(uint8_t addr) {
+    addr_ = addr;
+#if HAVE_GT911_LIB
+    using_lib = gt.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL, addr, TOUCH_RST_PIN, TOUCH_INT_PIN);
+    if (using_lib) Serial.println(F("[touch] GT911 library initialized"));
+    else           Serial.println(F("[touch] GT911 lib init failed; using raw I2C"));
+#else
+    using_lib = false;
+    Serial.println(F("[touch] GT911 lib not present; using raw I2C"));
+#endif
+    return true;
+  }
+
+  static bool read(TouchPoint& p) {
+#if HAVE_GT911_LIB
+    if (using_lib) {
+      gt.read();
+      if (!gt.isTouched()) return false;
+      auto pt = gt.getPoint(0);
+      p.x = pt.x; p.y = pt.y;
+      return true;
+    }
+#endif
+    // raw minimal read (with robust ack/clear)
+    bool pressed = false;
+    uint8_t status = 0;
+    if (!i2c_read_block(addr_, GT_REG_STATUS, &status, 1)) return false;
+    uint8_t n = status & 0x0F;
+    bool buf_ready = status & 0x80;
+    if (!buf_ready) return false;
+
+    // Try read first point anyway
+    GTPointRaw pr{};
+    if (i2c_read_block(addr_, GT_REG_POINTS, (uint8_t*)&pr, sizeof(pr))) {
+      if (n > 0 && pr.x != 0xFFFF && pr.y != 0xFFFF) {
+        p.x = (int16_t)pr.x; p.y = (int16_t)pr.y; pressed = true;
+      }
+      // Periodic debug
+      static uint32_t last_dump = 0;
+      uint32_t now = millis();
+      if (now - last_dump > 700) {
+        Serial.printf("[touch][GT] status=0x%02X n=%u peek: x=%u y=%u id=%u size=%u\n",
+                      status, n, pr.x, pr.y, pr.id, pr.size);
+        last_dump = now;
+      }
+    }
+    // ACK/CLEAR the buffer-ready flag ALWAYS
+    (void)i2c_write_u8(addr_, GT_REG_STATUS, 0x00);
+    return pressed;
+  }
+};
+#endif
+
+/* ---------------- CST816S/T/D (Hynitron, 8-bit regs) ------------------ */
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_CST816
+struct Cst816Driver {
+  static constexpr TouchIC     IC   = TouchIC::CST816;
+  static constexpr const char* NAME = "CST816";
+  static constexpr uint8_t     ADDR = 0x15;
+
+  static bool probe(uint8_t& addr) {
+    if (!i2c_registry_check(ADDR)) return false;   // note: sleeps (NACKs) after ~2 s idle unless reset
+    uint8_t id = 0, reg[1] = { 0xA7 };    // ChipID: B4=816S B5=816T B6=816D
+    if (!i2c_read(ADDR, reg, 1, &id, 1) || id < 0xB4 || id > 0xB6) return false;
+    Serial.printf("[touch][CST] ChipID=0x%02X\n", id);
+    i2c_bus_nack_expected(ADDR);          // asleep between touches: not a bus fault
+    addr = ADDR;
+    return true;
+  }
+  static bool begin(uint8_t) { return true; }
+  static bool read(TouchPoint& p) {
+    uint8_t b[5], reg[1] = { 0x02 };      // FingerNum, XposH, XposL, YposH, YposL
+    if (!i2c_read(ADDR, reg, 1, b, sizeof(b)) || (b[0] & 0x0F) == 0) return false;
+    p.x = int16_t(((b[1] & 0x0F) << 8) | b[2]);
+    p.y = int16_t(((b[3] & 0x0F) << 8) | b[4]);
+    return true;
+  }
+};
+#endif
+
+/* ---------------- Simulated panel (no bus) ----------------------------
+ * Runs a fixed script (drag across the volume slider, tap Play) unless
+ * points are injected; lets the whole LVGL input pipeline run without a
+ * touch controller attached. Coordinates are raw, i.e. pre-calibration.
+ * ----------------------------------------------------------------------- */
+#if TOUCH_DRIVER == TOUCH_DRV_SIM
+struct SimTouchDriver {
+  static constexpr TouchIC     IC   = TouchIC::SIM;
+  static constexpr const char* NAME = "SIM";
+  static inline bool     injected = false;
+  static inline bool     inj_pressed = false;
+  static inline TouchPoint inj{};
+  static inline uint32_t t0 = 0;
+
+  static void inject(int16_t x, int16_t y, bool pressed) { injected = true; inj = { x, y }; inj_pressed = pressed; }
+  static void run_script() { injected = false; t0 = millis(); }
+
+  static bool probe(uint8_t& addr) { addr = 0x00; return true; }
+  static bool begin(uint8_t) { t0 = millis(); return true; }
+  static bool read(TouchPoint& p) {
+    if (injected) { p = inj; return inj_pressed; }
+    // 4 s loop: 0-1.2 s drag volume 0->100, 2.5-2.6 s tap Play
+    const uint32_t t = (millis() - t0) % 4000;
+    if (t < 1200) { p.x = int16_t(300 + (t * 400) / 1200); p.y = 327; return true; }
+    if (t >= 2500 && t < 2600) { p.x = 72; p.y = 322; return true; }
+    return false;
+  }
+};
+#endif
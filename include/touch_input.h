@@ -2,16 +2,19 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <lvgl.h>
+#include "i2c_bus.h"   // pins/speed (shared with CH422G) + bus helpers
 
-/* ---------------- I2C pins / speed (shared with CH422G) --------------- */
-#ifndef TOUCH_I2C_SDA
-#define TOUCH_I2C_SDA 8
-#endif
-#ifndef TOUCH_I2C_SCL
-#define TOUCH_I2C_SCL 9
-#endif
-#ifndef TOUCH_I2C_FREQ
-#define TOUCH_I2C_FREQ 100000   // keep 100k during bring-up; can raise after detect
+/* ---------------- Driver selection ------------------------------------ */
+/* The board config picks the controller at compile time; AUTO probes the
+   bus at boot. Either way the read callback is instantiated per driver, so
+   the per-sample path has no IC dispatch (see touch_drivers.h). */
+#define TOUCH_DRV_AUTO   0
+#define TOUCH_DRV_GT911  1
+#define TOUCH_DRV_FT6X36 2
+#define TOUCH_DRV_CST816 3
+#define TOUCH_DRV_SIM    4   // scripted/injected points, no bus (bring-up + benchmarks)
+#ifndef TOUCH_DRIVER
+#define TOUCH_DRIVER TOUCH_DRV_AUTO
 #endif
 
 /* ---------------- Panel size for mapping ------------------------------ */
@@ -34,6 +37,8 @@
 #endif
 
 /* ---------------- Simple calibration offsets (NEW) --------------------- */
+/* Together with the orientation toggles these seed the default affine map;
+   a calibration stored in NVS (see touch_calib.h) replaces it at runtime. */
 /* Positive X moves touch to the RIGHT; positive Y moves touch DOWN */
 #ifndef TOUCH_X_OFFSET
 #define TOUCH_X_OFFSET 0
@@ -50,12 +55,82 @@
 #define TOUCH_INT_PIN -1
 #endif
 
+/* ---------------- Adaptive polling ------------------------------------ */
+/* The indev read timer runs fast while a finger is down and drops to the
+   idle period after TOUCH_IDLE_AFTER_MS without contact. With TOUCH_INT_PIN
+   wired, idle reads skip the bus entirely until the INT edge fires. */
+#ifndef TOUCH_POLL_ACTIVE_MS
+#define TOUCH_POLL_ACTIVE_MS 10
+#endif
+#ifndef TOUCH_POLL_IDLE_MS
+#define TOUCH_POLL_IDLE_MS 100
+#endif
+#ifndef TOUCH_IDLE_AFTER_MS
+#define TOUCH_IDLE_AFTER_MS 1500
+#endif
+#ifndef TOUCH_INT_EDGE
+#define TOUCH_INT_EDGE FALLING
+#endif
+#ifndef TOUCH_SAMPLE_WAIT_US
+#define TOUCH_SAMPLE_WAIT_US 2000   // read cb waits this long for the sample it kicked
+#endif
+
+/* ---------------- GT911 config programming ---------------------------- */
+/* 0 = leave the controller config alone, 1 = dry-run (log diff only), 2 = write */
+#ifndef TOUCH_GT_CFG_MODE
+#define TOUCH_GT_CFG_MODE 1
+#endif
+/* Report interval in ms (GT911 supports 5..20); match the LVGL indev read period */
+#ifndef TOUCH_GT_REPORT_MS
+#define TOUCH_GT_REPORT_MS LV_DEF_REFR_PERIOD
+#endif
+/* We only consume the first point; fewer points = shorter scan + smaller reads */
+#ifndef TOUCH_GT_TOUCH_POINTS
+#define TOUCH_GT_TOUCH_POINTS 1
+#endif
+/* Touch/leave thresholds; 0 keeps whatever the panel vendor programmed */
+#ifndef TOUCH_GT_TOUCH_LEVEL
+#define TOUCH_GT_TOUCH_LEVEL 0
+#endif
+#ifndef TOUCH_GT_LEAVE_LEVEL
+#define TOUCH_GT_LEAVE_LEVEL 0
+#endif
+
+/* Raw controller point -> screen, Q16 fixed point:
+     x = (a*rx + b*ry + c) >> 16,   y = (d*rx + e*ry + f) >> 16
+   c/f carry +0.5 so the shift rounds to nearest. */
+struct TouchAffine { int32_t a, b, c, d, e, f; };
+
+enum class TouchIC : uint8_t { NONE=0, FT6X36, GT911, CST816, SIM };
+
 /* Public API */
-void touch_init_and_register_lvgl();  // detect FT/GT, register LVGL indev
+void touch_init_and_register_lvgl();  // detect FT/GT, register LVGL indev (again: re-detect, same indev)
 bool touch_present();
+TouchIC touch_ic();                   // NONE until detected
+bool touch_reinit_now();              // after an external controller reset: probe + begin() again
+/* Board-specific controller reset (GT911 via the CH422G), run on the bus task
+   by the failure monitor before re-initialising a GT911; true if it answers */
+typedef bool (*TouchHwResetFn)();
+void touch_on_hw_reset(TouchHwResetFn fn);
 const char* touch_ic_name();
 uint8_t touch_i2c_address();
+lv_indev_t* touch_indev();            // nullptr until registered
+
+/* Calibration hooks */
+TouchAffine touch_default_affine();   // from TOUCH_SWAP_XY/INVERT/OFFSET
+TouchAffine touch_get_affine();
+void touch_set_affine(const TouchAffine& m);
+bool touch_last_raw(int16_t& x, int16_t& y);   // last pressed point before mapping
+
+/* Poll-rate / bus-occupancy stats (per mode, since boot) */
+void touch_print_stats(Stream& out = Serial);
+/* UI task, before lv_timer_handler(): if INT fired while idle, make the read timer due now */
+void touch_poll_kick();
+/* Screen off: stay in idle polling (INT-only when TOUCH_INT_PIN is wired); the
+   first press calls on_wake once and is swallowed until the finger lifts */
+void touch_set_sleep(bool sleep, void (*on_wake)() = nullptr);
 
-/* Utilities you can call from main for debugging */
-bool i2c_bus_recover(uint8_t sclPin = TOUCH_I2C_SCL, uint8_t sdaPin = TOUCH_I2C_SDA);
-void i2c_full_scan_print(Stream& out = Serial);
+/* GT911: diff current config against the desired one (see TOUCH_GT_* above).
+   write=false only prints the diff; write=true also programs + verifies.
+   Returns true if the controller config matches the desired one afterwards. */
+bool touch_gt911_config_sync(bool write, Stream& out = Serial);
@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/* ---------------- Touch trace recorder / replay ------------------------
+ * Records what touch_read_cb hands to LVGL (state + mapped point) as
+ * compact 6-byte samples, and replays it through a second pointer indev
+ * at original or accelerated speed for repeatable UI benchmarks.
+ *
+ * Binary format (little-endian):
+ *   header  "TTRC" u8 version u8 reserved u16 count
+ *   sample  u16 dt_ms (since previous sample)
+ *           u16 x | 0x8000 when pressed
+ *           u16 y
+ * Only state/position changes are stored; a sample holds until the next.
+ * ----------------------------------------------------------------------- */
+#ifndef TOUCH_TRACE_MAX_SAMPLES
+#define TOUCH_TRACE_MAX_SAMPLES 8192   // 48 KB in PSRAM
+#endif
+#ifndef TOUCH_TRACE_PATH
+#define TOUCH_TRACE_PATH "/touch.trc"
+#endif
+
+struct __attribute__((packed)) TouchTraceSample {
+  uint16_t dt_ms;
+  uint16_t x_state;   // bit15 = pressed
+  uint16_t y;
+};
+
+/* Recording (called from the touch read path) */
+void touch_trace_start();
+void touch_trace_stop();              // also saves to flash when available
+bool touch_trace_recording();
+void touch_trace_record(const lv_indev_data_t* data);
+
+/* Replay: speed_x = 1 for original timing, 4 = four times faster, ... */
+bool touch_trace_replay(uint8_t speed_x = 1);
+bool touch_trace_replaying();
+
+/* Storage / export */
+bool touch_trace_save(const char* path = TOUCH_TRACE_PATH);
+bool touch_trace_load(const char* path = TOUCH_TRACE_PATH);
+void touch_trace_dump(Stream& out = Serial);   // hex lines between TTRC-BEGIN/END
+size_t touch_trace_count();
@@ -0,0 +1,63 @@
+// src/app_model.cpp
+#include "app_model.h"
+#include "seqlock.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static SeqLock<AppModel> s_model;
+
+void app_model_publish(const AppModel& m) { s_model.store(m); }
+AppModel app_model_read(uint32_t* version) { return s_model.load(version); }
+uint32_t app_model_version() { return s_model.version(); }
+
+// -------- Stress check --------
+// Every word of the payload carries the same counter; any mismatch is a torn read
+struct StressPayload { uint32_t w[8]; };
+
+static SeqLock<StressPayload> s_st;
+static volatile bool s_st_running = false, s_st_stop = false;
+static uint32_t      s_st_writes = 0;
+
+static void stress_writer(void*) {
+  StressPayload p;
+  uint32_t c = 0;
+  while (!s_st_stop) {
+    ++c;
+    for (uint32_t& x : p.w) x = c;
+    s_st.store(p);
+    if ((c & 0xFFF) == 0) vTaskDelay(1);    // let IDLE0 feed the task watchdog
+  }
+  s_st_writes = c;
+  vTaskDelete(nullptr);
+}
+
+static void stress_reader(void*) {
+  uint32_t reads = 0, torn = 0, retries = 0, last = 0, backwards = 0;
+  const uint32_t t0 = millis();
+  while (millis() - t0 < APP_MODEL_STRESS_MS) {
+    const StressPayload p = s_st.load(nullptr, &retries);
+    reads++;
+    for (uint32_t x : p.w) if (x != p.w[0]) { torn++; break; }
+    if (p.w[0] < last) backwards++;
+    last = p.w[0];
+    if ((reads & 0xFFF) == 0) vTaskDelay(1);
+  }
+  s_st_stop = true;
+  vTaskDelay(pdMS_TO_TICKS(20));            // writer exits and records its count
+  Serial.printf("[model] stress %u ms: %lu writes, %lu reads, %lu retries, %lu torn, %lu out-of-order -> %s\n",
+                (unsigned)APP_MODEL_STRESS_MS, (unsigned long)s_st_writes, (unsigned long)reads,
+                (unsigned long)retries, (unsigned long)torn, (unsigned long)backwards,
+                (torn || backwards) ? "FAIL" : "OK");
+  s_st_running = false;
+  vTaskDelete(nullptr);
+}
+
+bool app_model_stress_start() {
+  if (s_st_running) return false;
+  s_st_running = true; s_st_stop = false; s_st_writes = 0;
+  TaskHandle_t w = nullptr, r = nullptr;
+  if (xTaskCreatePinnedToCore(stress_writer, "mdl_w", 2048, nullptr, 1, &w, 0) != pdPASS) { s_st_running = false; return false; }
+  if (xTaskCreatePinnedToCore(stress_reader, "mdl_r", 3072, nullptr, 1, &r, 1) != pdPASS) { s_st_stop = true; s_st_running = false; return false; }
+  Serial.printf("[model] seqlock stress running for %u ms\n", (unsigned)APP_MODEL_STRESS_MS);
+  return true;
+}
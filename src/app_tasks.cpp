@@ -0,0 +1,160 @@
+// src/app_tasks.cpp
+#include "app_tasks.h"
+#include "i2c_bus.h"
+#include "touch_input.h"
+#include "cpu_monitor.h"
+#include "power_mgmt.h"
+#include <lvgl.h>
+#include <freertos/queue.h>
+
+struct QueueStats { uint32_t posted, dropped; UBaseType_t peak; };
+static portMUX_TYPE s_qs_mux = portMUX_INITIALIZER_UNLOCKED;   // posters run on both cores
+
+static QueueHandle_t s_ui_q = nullptr, s_net_q = nullptr;
+static QueueStats    s_ui_qs = {}, s_net_qs = {};
+static TaskHandle_t  s_ui = nullptr, s_io = nullptr, s_net = nullptr;
+static UiMsgFn       s_on_ui = nullptr;
+static NetMsgFn      s_on_net = nullptr;
+static NetPollFn     s_net_poll = nullptr;
+
+// ui loop wakeups: timed out (LVGL timer due) vs notified (event)
+static struct { uint32_t timed, woken, slept_ms; uint32_t since_ms; } s_ui_wk = {};
+
+static bool post(QueueHandle_t q, QueueStats& st, const void* m) {
+  const bool ok = q && xQueueSend(q, m, 0) == pdTRUE;
+  const UBaseType_t n = ok ? uxQueueMessagesWaiting(q) : 0;
+  portENTER_CRITICAL(&s_qs_mux);
+  if (!ok) st.dropped++;
+  else { st.posted++; if (n > st.peak) st.peak = n; }
+  portEXIT_CRITICAL(&s_qs_mux);
+  return ok;
+}
+
+bool ui_post(const UiMsg& m) {
+  if (!post(s_ui_q, s_ui_qs, &m)) return false;
+  ui_wake();
+  return true;
+}
+bool net_post(const NetMsg& m) { return post(s_net_q, s_net_qs, &m); }
+
+void ui_wake() { if (s_ui) xTaskNotifyGive(s_ui); }
+
+void IRAM_ATTR ui_wake_from_isr() {
+  if (!s_ui) return;
+  BaseType_t hp = pdFALSE;
+  vTaskNotifyGiveFromISR(s_ui, &hp);
+  portYIELD_FROM_ISR(hp);
+}
+
+// -------- Tasks --------
+static void ui_task(void*) {
+  UiMsg m;
+  s_ui_wk.since_ms = millis();
+  for (;;) {
+    pm_lock(PmLock::RENDER);                  // full clock only while there is work
+    cpu_mon_loop_begin();
+    while (xQueueReceive(s_ui_q, &m, 0) == pdTRUE) s_on_ui(m);
+    touch_poll_kick();                        // touch INT seen: read now, not at the idle period
+
+    // Sleep exactly until the next LVGL timer (LV_NO_TIMER_READY -> cap), or until woken
+    uint32_t next = lv_timer_handler();
+    if (next > APP_UI_MAX_SLEEP_MS) next = APP_UI_MAX_SLEEP_MS;
+    if (next < 1) next = 1;
+    cpu_mon_loop_end();
+    pm_unlock(PmLock::RENDER);
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(next))) s_ui_wk.woken++;
+    else                                              s_ui_wk.timed++;
+    s_ui_wk.slept_ms += next;
+  }
+}
+
+static void io_task(void*) {
+  for (;;) {
+    while (Serial.available()) {
+      UiMsg m{};
+      m.type = UiMsgType::KEY;
+      m.key = (char)Serial.read();
+      (void)ui_post(m);
+    }
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
+static void net_task(void*) {
+  NetMsg m;
+  TickType_t next = xTaskGetTickCount() + pdMS_TO_TICKS(APP_NET_POLL_MS);
+  for (;;) {
+    const TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(next - now) <= 0) {
+      if (s_net_poll) s_net_poll();
+      next = now + pdMS_TO_TICKS(APP_NET_POLL_MS);
+      continue;
+    }
+    if (xQueueReceive(s_net_q, &m, next - now) == pdTRUE && s_on_net) s_on_net(m);
+  }
+}
+
+static bool spawn(TaskFunction_t fn, const char* name, uint32_t stack, UBaseType_t prio, BaseType_t core, TaskHandle_t* h) {
+  if (xTaskCreatePinnedToCore(fn, name, stack, nullptr, prio, h, core) == pdPASS) return true;
+  Serial.printf("[tasks] %s create failed\n", name);
+  *h = nullptr;
+  return false;
+}
+
+static void unspawn(TaskHandle_t& h) {
+  if (h) { vTaskDelete(h); h = nullptr; }
+}
+
+// Back to nothing running, so the caller's loop() fallback owns Serial/LVGL alone
+static void teardown() {
+  unspawn(s_ui); unspawn(s_net); unspawn(s_io);
+  if (s_ui_q)  { vQueueDelete(s_ui_q);  s_ui_q = nullptr; }
+  if (s_net_q) { vQueueDelete(s_net_q); s_net_q = nullptr; }
+}
+
+bool app_tasks_start(UiMsgFn on_ui, NetMsgFn on_net, NetPollFn net_poll) {
+  if (s_ui) return true;
+  s_on_ui = on_ui; s_on_net = on_net; s_net_poll = net_poll;
+  s_ui_q  = xQueueCreate(APP_UI_QUEUE_LEN, sizeof(UiMsg));
+  s_net_q = xQueueCreate(APP_NET_QUEUE_LEN, sizeof(NetMsg));
+  if (!s_ui_q || !s_net_q) { Serial.println("[tasks] queue alloc failed"); teardown(); return false; }
+
+  // ui last: once it runs, setup() must not touch LVGL any more
+  const bool ok = spawn(io_task,  "io",  APP_IO_STACK,  APP_IO_PRIO,  APP_IO_CORE, &s_io)
+               && spawn(net_task, "net", APP_NET_STACK, APP_NET_PRIO, APP_IO_CORE, &s_net)
+               && spawn(ui_task,  "ui",  APP_UI_STACK,  APP_UI_PRIO,  APP_UI_CORE, &s_ui);
+  if (!ok) { teardown(); return false; }
+  Serial.printf("[tasks] ui on core %d; io, net, i2c_bus on core %d\n", APP_UI_CORE, APP_IO_CORE);
+  return true;
+}
+
+bool app_tasks_running() { return s_ui != nullptr; }
+
+// -------- Report --------
+static void print_task(Stream& out, const char* name, TaskHandle_t h, uint32_t stack, int core) {
+  if (!h) { out.printf("[tasks]  %-8s (not running)\n", name); return; }
+  // ESP-IDF reports the high-water mark in bytes
+  const uint32_t free_min = uxTaskGetStackHighWaterMark(h);
+  out.printf("[tasks]  %-8s core %d  stack %5lu  min free %5lu  (peak use %lu%%)\n", name, core,
+             (unsigned long)stack, (unsigned long)free_min,
+             stack ? (unsigned long)((stack - free_min) * 100 / stack) : 0ul);
+}
+
+void app_tasks_print(Stream& out) {
+  out.println(F("[tasks] stack high-water marks"));
+  print_task(out, "ui",      s_ui,  APP_UI_STACK,  APP_UI_CORE);
+  print_task(out, "io",      s_io,  APP_IO_STACK,  APP_IO_CORE);
+  print_task(out, "net",     s_net, APP_NET_STACK, APP_IO_CORE);
+  print_task(out, "i2c_bus", i2c_bus_task(), I2C_BUS_STACK, I2C_BUS_TASK_CORE);
+  const uint32_t el = millis() - s_ui_wk.since_ms, n = s_ui_wk.timed + s_ui_wk.woken;
+  out.printf("[tasks] ui wakeups: %lu (%lu timer, %lu event)  %.1f/s  avg timeout %lu ms\n",
+             (unsigned long)n, (unsigned long)s_ui_wk.timed, (unsigned long)s_ui_wk.woken,
+             el ? n * 1000.0f / el : 0.0f, n ? (unsigned long)(s_ui_wk.slept_ms / n) : 0ul);
+  portENTER_CRITICAL(&s_qs_mux);
+  const QueueStats ui = s_ui_qs, net = s_net_qs;
+  portEXIT_CRITICAL(&s_qs_mux);
+  out.printf("[tasks] ui queue:  %lu posted, %lu dropped, peak %u/%u\n",
+             (unsigned long)ui.posted, (unsigned long)ui.dropped, (unsigned)ui.peak, (unsigned)APP_UI_QUEUE_LEN);
+  out.printf("[tasks] net queue: %lu posted, %lu dropped, peak %u/%u\n",
+             (unsigned long)net.posted, (unsigned long)net.dropped, (unsigned)net.peak, (unsigned)APP_NET_QUEUE_LEN);
+}
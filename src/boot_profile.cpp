@@ -0,0 +1,23 @@
+// src/boot_profile.cpp
+#include "boot_profile.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+struct BootMark { const char* stage; int64_t t_us; };
+
+static BootMark s_marks[BOOT_MAX_MARKS];
+static uint8_t  s_n = 0;
+
+void boot_mark(const char* stage) {
+  if (s_n < BOOT_MAX_MARKS) s_marks[s_n++] = { stage, esp_timer_get_time() };
+}
+
+void boot_report(Stream& out) {
+  out.printf("[boot] %s boot, %u stages\n", BOOT_FAST ? "fast" : "normal", (unsigned)s_n);
+  int64_t prev = 0;
+  for (uint8_t i = 0; i < s_n; ++i) {
+    const BootMark& m = s_marks[i];
+    out.printf("[boot] %8.1f ms  +%7.1f ms  %s\n", m.t_us / 1000.0, (m.t_us - prev) / 1000.0, m.stage);
+    prev = m.t_us;
+  }
+}
@@ -0,0 +1,78 @@
+// src/ch422g.cpp
+#include "ch422g.h"
+#include "i2c_registry.h"
+#include "i2c_trace.h"
+#include <Arduino.h>
+
+static constexpr uint8_t SET_IO_OE = 0x01;   // WR_SET bit0: IO0-7 push-pull outputs
+
+// staged (what callers asked for) vs. committed (what the chip has)
+static uint8_t  s_dir = 0x00, s_out = 0xFF;          // dir bit = 1 -> output
+static uint8_t  s_hw_set = 0x00, s_hw_io = 0xFF;
+static bool     s_hw_valid = false;                  // force a full push after begin
+static uint32_t s_writes = 0;
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool cmd_write(uint8_t cmd, uint8_t v) {
+  const uint32_t t0 = micros();
+  s_writes++;
+  const bool ok = i2c_raw_write(cmd, &v, 1) == I2cRc::OK;
+  i2c_bus_note(ok);
+  i2c_trace_record(I2cOp::EXIO, cmd, v, 1, ok, t0);   // reg column shows the byte written
+  return ok;
+}
+
+void ch422g_pin_mode(uint8_t pin, uint8_t mode) {
+  if (pin > 7) return;
+  portENTER_CRITICAL(&s_mux);
+  if (mode == OUTPUT) s_dir |= uint8_t(1u << pin);
+  else                s_dir &= uint8_t(~(1u << pin));
+  portEXIT_CRITICAL(&s_mux);
+}
+
+void ch422g_write_mask(uint8_t mask, uint8_t levels) {
+  portENTER_CRITICAL(&s_mux);
+  s_out = uint8_t((s_out & ~mask) | (levels & mask));
+  portEXIT_CRITICAL(&s_mux);
+}
+
+void ch422g_write(uint8_t pin, uint8_t level) {
+  if (pin > 7) return;
+  ch422g_write_mask(uint8_t(1u << pin), level ? 0xFF : 0x00);
+}
+
+bool ch422g_commit() {
+  portENTER_CRITICAL(&s_mux);
+  const uint8_t set = s_dir ? SET_IO_OE : 0x00;
+  const uint8_t io  = uint8_t(s_out | ~s_dir);       // released pins stay high
+  portEXIT_CRITICAL(&s_mux);
+
+  const bool need_set = !s_hw_valid || set != s_hw_set;
+  const bool need_io  = !s_hw_valid || io  != s_hw_io;
+  if (!need_set && !need_io) return true;
+
+  return i2c_bus_call(I2cClient::EXPANDER, I2cPrio::NORMAL, [&]{
+    // Output levels first so a bank switching to output comes up with the right values
+    if (need_io  && !cmd_write(CH422G_WR_IO,  io))  return false;
+    if (need_set && !cmd_write(CH422G_WR_SET, set)) return false;
+    s_hw_io = io; s_hw_set = set; s_hw_valid = true;
+    return true;
+  });
+}
+
+bool ch422g_begin() {
+  s_hw_valid = false;
+  if (!i2c_registry_check(CH422G_WR_SET)) return false;
+  return ch422g_commit();
+}
+
+bool ch422g_read_inputs(uint8_t& levels) {
+  return i2c_bus_call(I2cClient::EXPANDER, I2cPrio::NORMAL, [&]{
+    const uint32_t t0 = micros();
+    const bool ok = i2c_raw_read(CH422G_RD_IO, nullptr, 0, &levels, 1) == I2cRc::OK;
+    i2c_trace_record(I2cOp::EXIO, CH422G_RD_IO, 0, 1, ok, t0);
+    return ok;
+  });
+}
+
+uint32_t ch422g_write_count() { return s_writes; }
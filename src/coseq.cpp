@@ -0,0 +1,37 @@
+// src/coseq.cpp
+#include "coseq.h"
+#include <lvgl.h>
+
+struct CoRunner {
+  CoSeq       co;
+  CoStepFn    step;
+  void*       ctx;
+  CoDoneFn    done;
+  lv_timer_t* timer;
+};
+
+static CoRunner s_run[CO_LV_MAX] = {};
+
+static void co_timer_cb(lv_timer_t* t) {
+  CoRunner* r = static_cast<CoRunner*>(lv_timer_get_user_data(t));
+  const CoRc rc = r->step(r->co, r->ctx);
+  if (rc == CoRc::WAIT) {
+    const uint32_t w = co_wait_ms(r->co);
+    lv_timer_set_period(t, w ? w : 1);
+    return;
+  }
+  lv_timer_delete(t);
+  r->timer = nullptr;
+  if (r->done) r->done(r->ctx, rc == CoRc::DONE);
+}
+
+bool co_start_lv(CoStepFn step, void* ctx, CoDoneFn done) {
+  for (CoRunner& r : s_run) {
+    if (r.timer) continue;
+    r.co.reset(); r.step = step; r.ctx = ctx; r.done = done;
+    r.timer = lv_timer_create(co_timer_cb, 1, &r);
+    lv_timer_ready(r.timer);          // first step on the next lv_timer_handler()
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,179 @@
+// src/cpu_monitor.cpp
+#include "cpu_monitor.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined(configGENERATE_RUN_TIME_STATS) && configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY
+  #define CPU_MON_RT 1
+#else
+  #define CPU_MON_RT 0
+#endif
+// Stock Arduino core (no run-time stats): per-core idle sampled from the tick hooks
+#if !CPU_MON_RT && __has_include(<esp_freertos_hooks.h>)
+  #include <esp_freertos_hooks.h>
+  #define CPU_MON_TICK 1
+#else
+  #define CPU_MON_TICK 0
+#endif
+
+// -------- ui loop timing (ui task only) --------
+static uint32_t s_loop[CPU_MON_LOOP_SAMPLES];
+static uint32_t s_loop_n = 0, s_loop_max = 0, s_loop_max_all = 0;
+static uint64_t s_busy_us = 0, s_busy_total_us = 0;
+static int64_t  s_t_begin = 0;
+
+void cpu_mon_loop_begin() { s_t_begin = esp_timer_get_time(); }
+
+void cpu_mon_loop_end() {
+  const uint32_t d = (uint32_t)(esp_timer_get_time() - s_t_begin);
+  s_busy_us += d;
+  s_busy_total_us += d;
+  if (s_loop_n < CPU_MON_LOOP_SAMPLES) s_loop[s_loop_n] = d;
+  s_loop_n++;
+  if (d > s_loop_max) s_loop_max = d;
+  if (d > s_loop_max_all) s_loop_max_all = d;
+}
+
+// -------- Per-task run time --------
+struct TaskShare { char name[configMAX_TASK_NAME_LEN]; int core; float pct; };
+
+static CpuWindow s_win = {};
+static int64_t   s_win_t0 = 0;
+static TaskShare s_share[CPU_MON_MAX_TASKS];
+static uint8_t   s_nshare = 0;
+
+#if CPU_MON_RT
+static TaskStatus_t s_ts[CPU_MON_MAX_TASKS];
+static struct { TaskHandle_t h; uint32_t rt; } s_prev[CPU_MON_MAX_TASKS];
+static uint8_t  s_nprev = 0;
+static uint32_t s_prev_total = 0;
+
+static uint32_t prev_rt(TaskHandle_t h) {
+  for (uint8_t i = 0; i < s_nprev; ++i) if (s_prev[i].h == h) return s_prev[i].rt;
+  return 0;                         // new task: whole counter is this window
+}
+
+static void sample_tasks() {
+  uint32_t total = 0;
+  const UBaseType_t n = uxTaskGetSystemState(s_ts, CPU_MON_MAX_TASKS, &total);
+  const uint32_t dt = total - s_prev_total;
+  s_win.idle_pct[0] = s_win.idle_pct[1] = 0;
+  s_nshare = 0;
+  for (UBaseType_t i = 0; i < n && dt; ++i) {
+    const TaskStatus_t& t = s_ts[i];
+    const float pct = (t.ulRunTimeCounter - prev_rt(t.xHandle)) * 100.0f / dt;
+    TaskShare& sh = s_share[s_nshare++];
+    strncpy(sh.name, t.pcTaskName, sizeof(sh.name) - 1); sh.name[sizeof(sh.name) - 1] = 0;
+    sh.core = (t.xCoreID == tskNO_AFFINITY) ? -1 : (int)t.xCoreID;
+    sh.pct = pct;   // of one core
+    if (!strncmp(t.pcTaskName, "IDLE", 4) && sh.core >= 0 && sh.core < 2) s_win.idle_pct[sh.core] = pct;
+  }
+  std::sort(s_share, s_share + s_nshare, [](const TaskShare& a, const TaskShare& b) { return a.pct > b.pct; });
+  for (UBaseType_t i = 0; i < n; ++i) s_prev[i] = { s_ts[i].xHandle, s_ts[i].ulRunTimeCounter };
+  s_nprev = (uint8_t)n;
+  s_prev_total = total;
+}
+#endif
+
+#if CPU_MON_TICK
+// Each tick, on each core: was that core's idle task the one interrupted?
+// Ticks skipped by tickless idle (light sleep) count as idle.
+static TaskHandle_t      s_idle_task[2];
+static volatile uint32_t s_ticks[2], s_idle_ticks[2];
+static int64_t           s_tick_us[2];
+static uint32_t          s_prev_ticks[2], s_prev_idle[2];
+
+static void IRAM_ATTR tick_sample() {
+  const int c = xPortGetCoreID();
+  const int64_t now = esp_timer_get_time();
+  uint32_t n = 1, idle = xTaskGetCurrentTaskHandle() == s_idle_task[c];
+  if (s_tick_us[c]) {
+    const uint32_t skipped = (uint32_t)((now - s_tick_us[c]) / (portTICK_PERIOD_MS * 1000));
+    if (skipped > 1) { n += skipped - 1; idle += skipped - 1; }
+  }
+  s_tick_us[c] = now;
+  s_ticks[c] += n;
+  s_idle_ticks[c] += idle;
+}
+
+static void sample_idle() {
+  for (int c = 0; c < 2; ++c) {
+    const uint32_t t = s_ticks[c], i = s_idle_ticks[c];
+    const uint32_t dt = t - s_prev_ticks[c];
+    s_win.idle_pct[c] = dt ? (i - s_prev_idle[c]) * 100.0f / dt : 0;
+    s_prev_ticks[c] = t; s_prev_idle[c] = i;
+  }
+}
+#endif
+
+void cpu_mon_update() {
+  const int64_t now = esp_timer_get_time();
+  if (!s_win_t0) {
+#if CPU_MON_TICK
+    for (int c = 0; c < 2; ++c) {
+      s_idle_task[c] = xTaskGetIdleTaskHandleForCPU(c);
+      esp_register_freertos_tick_hook_for_cpu(tick_sample, c);
+    }
+#endif
+    s_win_t0 = now;
+    return;
+  }
+  const uint64_t wall = (uint64_t)(now - s_win_t0);
+
+  static uint32_t sorted[CPU_MON_LOOP_SAMPLES];
+  const uint32_t m = std::min<uint32_t>(s_loop_n, CPU_MON_LOOP_SAMPLES);
+  std::copy(s_loop, s_loop + m, sorted);
+  std::sort(sorted, sorted + m);
+
+  s_win.have_rt = CPU_MON_RT;
+  s_win.have_idle = CPU_MON_RT || CPU_MON_TICK;
+  s_win.loops = s_loop_n;
+  s_win.loop_p99_us = m ? sorted[(m - 1) * 99 / 100] : 0;
+  s_win.loop_max_us = s_loop_max;
+  s_win.loop_max_all_us = s_loop_max_all;
+  s_win.ui_busy_pct = wall ? s_busy_us * 100.0f / wall : 0;
+#if CPU_MON_RT
+  sample_tasks();
+#elif CPU_MON_TICK
+  sample_idle();
+#endif
+
+  s_loop_n = 0; s_loop_max = 0; s_busy_us = 0;
+  s_win_t0 = now;
+}
+
+const CpuWindow& cpu_mon_last() { return s_win; }
+uint64_t cpu_mon_busy_us_total() { return s_busy_total_us; }
+
+void cpu_mon_format(char* out, size_t n) {
+  const CpuWindow& w = s_win;
+  if (w.have_idle)
+    snprintf(out, n, "cpu idle c0 %.0f%% c1 %.0f%%  ui %.1f%%  loop p99 %.1f ms max %.1f ms",
+             w.idle_pct[0], w.idle_pct[1], w.ui_busy_pct, w.loop_p99_us / 1000.0f, w.loop_max_us / 1000.0f);
+  else
+    snprintf(out, n, "cpu ui %.1f%%  loop p99 %.1f ms max %.1f ms  (%lu/s)",
+             w.ui_busy_pct, w.loop_p99_us / 1000.0f, w.loop_max_us / 1000.0f, (unsigned long)w.loops);
+}
+
+void cpu_mon_print(Stream& out) {
+  const CpuWindow& w = s_win;
+  out.printf("[cpu] window %u ms: ui loop %lu iterations, busy %.1f%%, p99 %lu us, max %lu us (boot max %lu us)\n",
+             (unsigned)CPU_MON_PERIOD_MS, (unsigned long)w.loops, w.ui_busy_pct,
+             (unsigned long)w.loop_p99_us, (unsigned long)w.loop_max_us, (unsigned long)w.loop_max_all_us);
+  if (w.have_idle)
+    out.printf("[cpu] idle: core0 %.1f%%  core1 %.1f%%%s\n", w.idle_pct[0], w.idle_pct[1],
+               w.have_rt ? "" : " (tick-sampled)");
+  if (!w.have_rt) {
+    out.println(F("[cpu] per-task shares need CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS"));
+    return;
+  }
+  for (uint8_t i = 0; i < s_nshare; ++i) {
+    const TaskShare& sh = s_share[i];
+    if (sh.core < 0) out.printf("[cpu]  %-16s  any   %5.1f%%\n", sh.name, sh.pct);
+    else             out.printf("[cpu]  %-16s  core%d %5.1f%%\n", sh.name, sh.core, sh.pct);
+  }
+}
@@ -0,0 +1,54 @@
+// src/hw_cache.cpp
+#include "hw_cache.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <string.h>
+
+static constexpr const char* NVS_NS  = "hw";
+static constexpr const char* NVS_KEY = "disc";
+static constexpr uint32_t HWC_MAGIC  = 0x48574331;   // "HWC1"
+
+struct StoredHw { uint32_t magic; HwCache hw; };
+
+static const HwCache kEmpty = { TouchIC::NONE, 0x00, 0xFF, 0xFF, 0 };
+static HwCache s_hw = kEmpty;
+static HwCache s_stored = kEmpty;   // what NVS holds, to skip no-op writes
+
+bool hw_cache_load() {
+  Preferences p;
+  if (!p.begin(NVS_NS, true)) return false;
+  StoredHw sh{};
+  const bool ok = p.getBytes(NVS_KEY, &sh, sizeof(sh)) == sizeof(sh) && sh.magic == HWC_MAGIC;
+  p.end();
+  s_hw = s_stored = ok ? sh.hw : kEmpty;
+  if (ok)
+    Serial.printf("[hw] cached: touch=%u @0x%02X  exio INT=%d RST=%d  clock=%lu Hz\n", (unsigned)s_hw.touch_ic,
+                  s_hw.touch_addr, s_hw.exio_int == 0xFF ? -1 : s_hw.exio_int,
+                  s_hw.exio_rst == 0xFF ? -1 : s_hw.exio_rst, (unsigned long)s_hw.clock_hz);
+  return ok;
+}
+
+const HwCache& hw_cache() { return s_hw; }
+
+void hw_cache_set_touch(TouchIC ic, uint8_t addr) { s_hw.touch_ic = ic; s_hw.touch_addr = addr; }
+void hw_cache_set_exio(uint8_t exio_int, uint8_t exio_rst) { s_hw.exio_int = exio_int; s_hw.exio_rst = exio_rst; }
+void hw_cache_set_clock(uint32_t hz) { s_hw.clock_hz = hz; }
+
+bool hw_cache_save() {
+  if (memcmp(&s_hw, &s_stored, sizeof(s_hw)) == 0) return true;
+  Preferences p;
+  if (!p.begin(NVS_NS, false)) return false;
+  StoredHw sh{ HWC_MAGIC, s_hw };
+  const bool ok = p.putBytes(NVS_KEY, &sh, sizeof(sh)) == sizeof(sh);
+  p.end();
+  if (ok) s_stored = s_hw;
+  Serial.printf("[hw] discovery cache %s\n", ok ? "updated" : "write FAILED");
+  return ok;
+}
+
+void hw_cache_clear() {
+  Preferences p;
+  if (p.begin(NVS_NS, false)) { p.remove(NVS_KEY); p.end(); }
+  s_hw = s_stored = kEmpty;
+  Serial.println(F("[hw] discovery cache cleared; next boot probes everything"));
+}
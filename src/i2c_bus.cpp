@@ -0,0 +1,309 @@
+// src/i2c_bus.cpp
+#include "i2c_bus.h"
+#include "i2c_clock.h"
+#include "i2c_health.h"
+#include "i2c_trace.h"
+#include "power_mgmt.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <string.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#if I2C_BACKEND_SIM
+  #include "i2c_sim.h"
+#elif I2C_BACKEND_IDF
+  #include <driver/i2c.h>
+#endif
+
+// -------- Bus manager --------
+static constexpr int PRIO_COUNT   = (int)I2cPrio::COUNT;
+static constexpr int CLIENT_COUNT = (int)I2cClient::COUNT;
+
+struct I2cJob {
+  I2cJobFn          fn;
+  void*             ctx;
+  I2cDoneFn         done;
+  SemaphoreHandle_t sync;      // set for blocking callers
+  bool*             result;
+  uint32_t          t_submit;
+  I2cClient         client;
+};
+
+struct ClientStats { uint32_t jobs, fails, wait_sum_us, wait_max_us, exec_sum_us, exec_max_us; };
+
+static QueueHandle_t s_q[PRIO_COUNT] = {};
+static TaskHandle_t  s_task = nullptr;
+static ClientStats   s_stats[CLIENT_COUNT] = {};
+
+static void run_job(const I2cJob& j) {
+  pm_lock(PmLock::I2C);
+  const uint32_t t0 = micros();
+  const bool ok = j.fn(j.ctx);
+  const uint32_t t1 = micros();
+  pm_unlock(PmLock::I2C);
+
+  ClientStats& st = s_stats[(int)j.client];
+  const uint32_t wait = t0 - j.t_submit, exec = t1 - t0;
+  st.jobs++; if (!ok) st.fails++;
+  st.wait_sum_us += wait; if (wait > st.wait_max_us) st.wait_max_us = wait;
+  st.exec_sum_us += exec; if (exec > st.exec_max_us) st.exec_max_us = exec;
+
+  if (j.done) j.done(j.ctx, ok);
+  if (j.sync) { *j.result = ok; xSemaphoreGive(j.sync); }
+}
+
+static void bus_task(void*) {
+  I2cJob j;
+  for (;;) {
+    i2c_health_service();   // outage recovery runs here, ahead of any client job
+    if (i2c_health_busy()) {  // mid-sequence (Wire down): jobs wait for the next step
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(i2c_health_wait_ms()) + 1);
+      continue;
+    }
+
+    // Highest priority first; re-check from the top after every job
+    bool ran = false;
+    for (int p = 0; p < PRIO_COUNT && !ran; ++p) {
+      if (xQueueReceive(s_q[p], &j, 0) == pdTRUE) { run_job(j); ran = true; }
+    }
+    if (!ran) ulTaskNotifyTake(pdTRUE, i2c_health_ok() ? portMAX_DELAY : pdMS_TO_TICKS(i2c_health_wait_ms()) + 1);
+  }
+}
+
+bool i2c_bus_start() {
+  if (s_task) return true;
+  for (int p = 0; p < PRIO_COUNT; ++p) {
+    s_q[p] = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(I2cJob));
+    if (!s_q[p]) return false;
+  }
+  if (xTaskCreatePinnedToCore(bus_task, "i2c_bus", I2C_BUS_STACK, nullptr, I2C_BUS_TASK_PRIO, &s_task,
+                              I2C_BUS_TASK_CORE) != pdPASS) {
+    s_task = nullptr;
+    return false;
+  }
+  Serial.printf("[i2c] bus manager running (core %d)\n", I2C_BUS_TASK_CORE);
+  return true;
+}
+
+bool i2c_bus_in_context() { return !s_task || xTaskGetCurrentTaskHandle() == s_task; }
+TaskHandle_t i2c_bus_task() { return s_task; }
+
+static bool enqueue(const I2cJob& j, I2cPrio p, TickType_t wait) {
+  if (xQueueSend(s_q[(int)p], &j, wait) != pdTRUE) return false;
+  xTaskNotifyGive(s_task);
+  return true;
+}
+
+bool i2c_bus_submit(I2cClient c, I2cPrio p, I2cJobFn fn, void* ctx, I2cDoneFn done) {
+  I2cJob j{ fn, ctx, done, nullptr, nullptr, (uint32_t)micros(), c };
+  if (i2c_bus_in_context()) { run_job(j); return true; }
+  return enqueue(j, p, 0);   // async callers never block; a full queue means "try next time"
+}
+
+bool i2c_bus_run(I2cClient c, I2cPrio p, I2cJobFn fn, void* ctx) {
+  bool result = false;
+  I2cJob j{ fn, ctx, nullptr, nullptr, &result, (uint32_t)micros(), c };
+  if (i2c_bus_in_context()) { run_job(j); return result; }
+
+  StaticSemaphore_t sem_buf;   // caller's stack: no heap traffic per call
+  j.sync = xSemaphoreCreateBinaryStatic(&sem_buf);
+  if (!enqueue(j, p, portMAX_DELAY)) { vSemaphoreDelete(j.sync); return false; }
+  xSemaphoreTake(j.sync, portMAX_DELAY);
+  vSemaphoreDelete(j.sync);
+  return result;
+}
+
+void i2c_bus_print_stats(Stream& out) {
+  static const char* const kName[CLIENT_COUNT] = { "touch", "expander", "diag", "other" };
+  out.printf("[i2c] manager %s\n", s_task ? "running" : "inline (not started)");
+  for (int c = 0; c < CLIENT_COUNT; ++c) {
+    const ClientStats& st = s_stats[c];
+    if (!st.jobs) continue;
+    out.printf("[i2c] %-8s jobs=%lu fail=%lu  wait avg/max=%lu/%lu us  exec avg/max=%lu/%lu us\n", kName[c],
+               (unsigned long)st.jobs, (unsigned long)st.fails,
+               (unsigned long)(st.wait_sum_us / st.jobs), (unsigned long)st.wait_max_us,
+               (unsigned long)(st.exec_sum_us / st.jobs), (unsigned long)st.exec_max_us);
+  }
+  i2c_clock_print(out);
+  i2c_health_print(out);
+}
+
+// -------- I2C helpers --------
+// Off the bus task these forward themselves as a blocking job
+#define I2C_FORWARD(call) \
+  if (!i2c_bus_in_context()) return i2c_bus_call(I2cClient::OTHER, I2cPrio::NORMAL, [&]{ return call; })
+
+void i2c_bus_note(bool ok) {
+  i2c_clock_note(ok);
+  i2c_health_note(ok);
+}
+
+static uint32_t s_nack_ok[4] = {};   // 128-bit map: addresses whose NACK means "asleep"
+
+void i2c_bus_nack_expected(uint8_t addr) { if (addr < 128) s_nack_ok[addr >> 5] |= 1u << (addr & 31); }
+
+static void note(uint8_t addr, I2cRc rc) {
+  if (rc == I2cRc::NACK && addr < 128 && ((s_nack_ok[addr >> 5] >> (addr & 31)) & 1u)) return;
+  i2c_bus_note(rc == I2cRc::OK);
+}
+
+// -------- Raw transfers (bus task only) --------
+#if I2C_BACKEND_SIM
+static I2cRc from_sim(I2cSimRc rc) {
+  return rc == I2cSimRc::OK ? I2cRc::OK : rc == I2cSimRc::NACK ? I2cRc::NACK : I2cRc::TIMEOUT;
+}
+I2cRc i2c_raw_probe(uint8_t addr) { return from_sim(i2c_sim_xfer(addr, nullptr, 0, nullptr, 0)); }
+I2cRc i2c_raw_write(uint8_t addr, const uint8_t* pkt, size_t n) { return from_sim(i2c_sim_xfer(addr, pkt, n, nullptr, 0)); }
+I2cRc i2c_raw_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len) {
+  return from_sim(i2c_sim_xfer(addr, reg, reg_len, buf, len));
+}
+void i2c_raw_set_clock(uint32_t hz) { i2c_sim_set_clock(hz); }
+#else
+// Wire.endTransmission(): 0 ok, 2/3 NACK, 5 timeout (arduino-esp32 2.x)
+static I2cRc from_wire(uint8_t rc) {
+  return rc == 0 ? I2cRc::OK : (rc == 2 || rc == 3) ? I2cRc::NACK : rc == 5 ? I2cRc::TIMEOUT : I2cRc::ERROR;
+}
+I2cRc i2c_raw_probe(uint8_t addr) {
+  Wire.beginTransmission(addr);
+  return from_wire(Wire.endTransmission());
+}
+void i2c_raw_set_clock(uint32_t hz) { Wire.setClock(hz); }
+#if I2C_BACKEND_IDF
+static I2cRc from_idf(esp_err_t err) {
+  return err == ESP_OK ? I2cRc::OK : err == ESP_FAIL ? I2cRc::NACK : err == ESP_ERR_TIMEOUT ? I2cRc::TIMEOUT : I2cRc::ERROR;
+}
+I2cRc i2c_raw_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len) {
+  const TickType_t to = pdMS_TO_TICKS(I2C_XFER_TIMEOUT_MS);
+  if (!reg_len) return from_idf(i2c_master_read_from_device((i2c_port_t)I2C_BUS_PORT, addr, buf, len, to));
+  return from_idf(i2c_master_write_read_device((i2c_port_t)I2C_BUS_PORT, addr, reg, reg_len, buf, len, to));
+}
+I2cRc i2c_raw_write(uint8_t addr, const uint8_t* pkt, size_t n) {
+  return from_idf(i2c_master_write_to_device((i2c_port_t)I2C_BUS_PORT, addr, pkt, n,
+                                             pdMS_TO_TICKS(I2C_XFER_TIMEOUT_MS)));
+}
+#else
+I2cRc i2c_raw_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len) {
+  if (reg_len) {
+    Wire.beginTransmission(addr);
+    Wire.write(reg, reg_len);
+    const I2cRc rc = from_wire(Wire.endTransmission(false));
+    if (rc != I2cRc::OK) return rc;
+  }
+  if (Wire.requestFrom((int)addr, (int)len) != (int)len) return I2cRc::NACK;
+  for (size_t i=0;i<len;i++) buf[i] = Wire.read();
+  return I2cRc::OK;
+}
+I2cRc i2c_raw_write(uint8_t addr, const uint8_t* pkt, size_t n) {
+  Wire.beginTransmission(addr);
+  Wire.write(pkt, n);
+  return from_wire(Wire.endTransmission());
+}
+#endif
+#endif
+
+
+bool i2c_probe(uint8_t addr) {
+  I2C_FORWARD(i2c_probe(addr));
+  const uint32_t t0 = micros();
+  const bool ok = i2c_raw_probe(addr) == I2cRc::OK;
+  i2c_trace_record(I2cOp::PROBE, addr, 0, 0, ok, t0);
+  return ok;
+}
+
+bool i2c_write_u8(uint8_t addr, uint16_t reg, uint8_t v) {
+  I2C_FORWARD(i2c_write_u8(addr, reg, v));
+  const uint32_t t0 = micros();
+  uint8_t pkt[3] = { uint8_t(reg>>8), uint8_t(reg&0xFF), v };
+  const I2cRc rc = i2c_raw_write(addr, pkt, 3);
+  const bool ok = rc == I2cRc::OK;
+  note(addr, rc);
+  i2c_trace_record(I2cOp::WRITE, addr, reg, 1, ok, t0);
+  return ok;
+}
+bool i2c_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len) {
+  I2C_FORWARD(i2c_read(addr, reg, reg_len, buf, len));
+  const uint32_t t0 = micros();
+  const I2cRc rc = i2c_raw_read(addr, reg, reg_len, buf, len);
+  const bool ok = rc == I2cRc::OK;
+  note(addr, rc);
+  i2c_trace_record(I2cOp::READ, addr, reg_len >= 2 ? uint16_t((reg[0] << 8) | reg[1]) : (reg_len ? reg[0] : 0),
+                   (uint16_t)len, ok, t0);
+  return ok;
+}
+
+// Block helpers for 16-bit register maps. Wire needs reads chunked to its
+// 128-byte buffer (32 keeps older cores happy); the IDF driver and sim do not.
+static constexpr size_t I2C_WRITE_CHUNK = 32;
+static constexpr size_t I2C_READ_CHUNK  = (I2C_BACKEND_IDF || I2C_BACKEND_SIM) ? SIZE_MAX : 32;
+bool i2c_read_block(uint8_t addr, uint16_t reg, uint8_t* buf, size_t len) {
+  I2C_FORWARD(i2c_read_block(addr, reg, buf, len));
+  for (size_t off = 0; off < len; off += I2C_READ_CHUNK) {
+    size_t n = (len - off < I2C_READ_CHUNK) ? (len - off) : I2C_READ_CHUNK;
+    uint8_t r[2] = { uint8_t((reg+off)>>8), uint8_t((reg+off)&0xFF) };
+    if (!i2c_read(addr, r, 2, buf + off, n)) return false;
+  }
+  return true;
+}
+bool i2c_write_block(uint8_t addr, uint16_t reg, const uint8_t* buf, size_t len) {
+  I2C_FORWARD(i2c_write_block(addr, reg, buf, len));
+  uint8_t pkt[2 + I2C_WRITE_CHUNK];
+  for (size_t off = 0; off < len; off += I2C_WRITE_CHUNK) {
+    size_t n = (len - off < I2C_WRITE_CHUNK) ? (len - off) : I2C_WRITE_CHUNK;
+    const uint32_t t0 = micros();
+    pkt[0] = uint8_t((reg+off)>>8);
+    pkt[1] = uint8_t((reg+off)&0xFF);
+    memcpy(pkt + 2, buf + off, n);
+    const I2cRc rc = i2c_raw_write(addr, pkt, 2 + n);
+    const bool ok = rc == I2cRc::OK;
+    note(addr, rc);
+    i2c_trace_record(I2cOp::WRITE, addr, uint16_t(reg + off), (uint16_t)n, ok, t0);
+    if (!ok) return false;
+  }
+  return true;
+}
+
+// -------- Bus recovery (if SDA stuck low) --------
+// Bus task only. The millisecond settles are yields; the SCL pulses and the
+// STOP stay inline (microseconds). Other jobs must not run until DONE/FAIL.
+CoRc i2c_bus_recover_co(CoSeq& co, uint8_t sclPin, uint8_t sdaPin) {
+#if I2C_BACKEND_SIM
+  (void)co; (void)sclPin; (void)sdaPin;
+  return i2c_sim_clock_pulses(16) ? CoRc::DONE : CoRc::FAIL;   // same pulse budget as below
+#endif
+  CO_BEGIN(co);
+  Wire.end();
+  pinMode(sclPin, INPUT_PULLUP);
+  pinMode(sdaPin, INPUT_PULLUP);
+  CO_SLEEP_MS(co, 1);
+
+  if (digitalRead(sdaPin) == HIGH) {
+    Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
+    Wire.setClock(i2c_clock_hz());
+    CO_RETURN(co, true);
+  }
+
+  // SDA low: clock SCL to free it
+  pinMode(sclPin, OUTPUT);
+  for (int i=0; i<16 && (digitalRead(sdaPin)==LOW); ++i) {
+    digitalWrite(sclPin, HIGH); delayMicroseconds(5);
+    digitalWrite(sclPin, LOW ); delayMicroseconds(5);
+  }
+
+  // STOP condition
+  pinMode(sdaPin, OUTPUT);
+  digitalWrite(sdaPin, LOW);  delayMicroseconds(5);
+  digitalWrite(sclPin, HIGH); delayMicroseconds(5);
+  digitalWrite(sdaPin, HIGH); delayMicroseconds(5);
+
+  Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
+  Wire.setClock(i2c_clock_hz());
+  CO_SLEEP_MS(co, 3);
+  CO_RETURN(co, digitalRead(sdaPin) == HIGH);
+  CO_END(co);
+}
+
+bool i2c_bus_recover(uint8_t sclPin, uint8_t sdaPin) {
+  I2C_FORWARD(i2c_bus_recover(sclPin, sdaPin));
+  CoSeq co;
+  return co_run_blocking(co, [=](CoSeq& c) { return i2c_bus_recover_co(c, sclPin, sdaPin); });
+}
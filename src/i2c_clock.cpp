@@ -0,0 +1,128 @@
+// src/i2c_clock.cpp
+#include "i2c_clock.h"
+#include "i2c_bus.h"
+#include "i2c_registry.h"
+#include "touch_input.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const uint32_t kSteps[] = { I2C_CLOCK_STEPS };
+static constexpr int STEP_N = sizeof(kSteps) / sizeof(kSteps[0]);
+
+static uint32_t s_hz = TOUCH_I2C_FREQ;
+static int      s_step = -1;                 // index into kSteps once negotiated
+static uint16_t s_win_n = 0, s_win_err = 0;
+static uint16_t s_backoffs = 0;
+
+struct StepErrors { uint16_t nack, timeout, mismatch; };
+
+// ID register of the detected touch controller, read back for consistency
+struct IdRead { uint8_t addr; uint8_t reg[2]; uint8_t reg_len; uint8_t len; };
+static bool touch_id_read(IdRead& r) {
+  r.addr = touch_i2c_address();
+  switch (r.addr) {
+    case 0x5D: case 0x14: r.reg[0] = 0x81; r.reg[1] = 0x40; r.reg_len = 2; r.len = 4; return true; // GT911 product ID
+    case 0x38:            r.reg[0] = 0xA8;                  r.reg_len = 1; r.len = 1; return true; // FT CHIPID
+    case 0x15:            r.reg[0] = 0xA7;                  r.reg_len = 1; r.len = 1; return true; // CST ChipID
+    default: return false;
+  }
+}
+
+static void count(I2cRc rc, StepErrors& e) {
+  if (rc == I2cRc::TIMEOUT) e.timeout++;
+  else if (rc != I2cRc::OK) e.nack++;
+}
+
+static bool raw_read(const IdRead& r, uint8_t* buf, StepErrors& e) {
+  const I2cRc rc = i2c_raw_read(r.addr, r.reg, r.reg_len, buf, r.len);
+  count(rc, e);
+  return rc == I2cRc::OK;
+}
+
+static void set_hz(uint32_t hz) { i2c_raw_set_clock(hz); s_hz = hz; }
+
+uint32_t i2c_clock_hz() { return s_hz; }
+
+// Reference ID of the touch controller, read once at the bring-up clock
+struct StepRef { IdRead id; uint8_t ref[4]; bool ok; };
+
+static void step_ref(StepRef& sr) {
+  StepErrors dummy{};
+  set_hz(TOUCH_I2C_FREQ);
+  sr.ok = touch_id_read(sr.id) && raw_read(sr.id, sr.ref, dummy);
+}
+
+static bool step_clean(uint32_t hz, int rounds, const StepRef& sr, Stream& out) {
+  size_t known_n = 0;
+  const I2cKnownDevice* known = i2c_registry_known(known_n);
+  uint8_t got[4] = {};
+  set_hz(hz);
+  StepErrors e{};
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t k = 0; k < known_n; ++k) {
+      if (!known[k].present) continue;
+      count(i2c_raw_probe(known[k].addr), e);
+    }
+    if (sr.ok && raw_read(sr.id, got, e) && memcmp(sr.ref, got, sr.id.len) != 0) e.mismatch++;
+  }
+  const bool clean = (e.nack + e.timeout + e.mismatch) == 0;
+  out.printf("[i2c] clock %7lu Hz: nack=%u timeout=%u mismatch=%u  %s\n", (unsigned long)hz,
+             (unsigned)e.nack, (unsigned)e.timeout, (unsigned)e.mismatch, clean ? "ok" : "unstable");
+  return clean;
+}
+
+static void settle(int step) {
+  s_step = step;
+  set_hz(kSteps[s_step]);
+  s_win_n = s_win_err = 0;
+}
+
+uint32_t i2c_clock_negotiate(Stream& out) {
+  (void)i2c_bus_call(I2cClient::OTHER, I2cPrio::NORMAL, [&]{
+    StepRef sr{};
+    step_ref(sr);
+    int best = -1;
+    for (int s = 0; s < STEP_N; ++s) {
+      if (!step_clean(kSteps[s], I2C_CLOCK_ROUNDS, sr, out)) break;   // faster steps will not do better
+      best = s;
+    }
+    settle(best < 0 ? 0 : best);
+    return best >= 0;
+  });
+  out.printf("[i2c] clock settled at %lu Hz\n", (unsigned long)s_hz);
+  return s_hz;
+}
+
+bool i2c_clock_verify(uint32_t hz, Stream& out) {
+  int step = -1;
+  for (int s = 0; s < STEP_N; ++s) if (kSteps[s] == hz) step = s;
+  if (step < 0) return false;
+  const bool ok = i2c_bus_call(I2cClient::OTHER, I2cPrio::NORMAL, [&]{
+    StepRef sr{};
+    step_ref(sr);
+    if (!step_clean(hz, 1, sr, out)) { set_hz(TOUCH_I2C_FREQ); return false; }
+    settle(step);
+    return true;
+  });
+  if (ok) out.printf("[i2c] cached clock %lu Hz verified\n", (unsigned long)hz);
+  return ok;
+}
+
+void i2c_clock_note(bool ok) {
+  if (s_step < 0) return;         // not negotiated yet: bring-up clock is fixed
+  if (!ok) s_win_err++;
+  if (++s_win_n < I2C_CLOCK_WINDOW) return;
+  if (s_win_err > I2C_CLOCK_BACKOFF_ERRS && s_step > 0) {
+    s_step--;
+    s_backoffs++;
+    set_hz(kSteps[s_step]);
+    Serial.printf("[i2c] %u/%u transfers failed -> clock back to %lu Hz\n",
+                  (unsigned)s_win_err, (unsigned)s_win_n, (unsigned long)s_hz);
+  }
+  s_win_n = s_win_err = 0;
+}
+
+void i2c_clock_print(Stream& out) {
+  out.printf("[i2c] clock %lu Hz (%s), window %u/%u errors, back-offs=%u\n", (unsigned long)s_hz,
+             s_step < 0 ? "bring-up" : "negotiated", (unsigned)s_win_err, (unsigned)s_win_n, (unsigned)s_backoffs);
+}
@@ -0,0 +1,70 @@
+// src/i2c_health.cpp
+#include "i2c_health.h"
+#include "i2c_bus.h"
+#include <Arduino.h>
+
+static I2cReinitFn s_reinit = nullptr;
+
+static bool     s_down = false;
+static uint16_t s_fail_run = 0;
+static uint32_t s_down_since_ms = 0, s_next_try_ms = 0, s_backoff_ms = 0;
+static uint16_t s_attempts = 0;
+static CoSeq    s_recover;               // bus recovery in progress (between settle steps)
+
+// session stats
+static uint32_t s_outages = 0, s_outage_total_ms = 0, s_outage_max_ms = 0;
+
+void i2c_health_on_recover(I2cReinitFn fn) { s_reinit = fn; }
+
+void i2c_health_note(bool ok) {
+  if (ok) { s_fail_run = 0; return; }
+  if (s_down || ++s_fail_run < I2C_HEALTH_FAIL_RUN) return;
+  s_down = true;
+  s_down_since_ms = s_next_try_ms = millis();
+  s_backoff_ms = I2C_HEALTH_BACKOFF_MIN_MS;
+  s_attempts = 0;
+  Serial.printf("[i2c] %u consecutive failures -> bus outage, recovering\n", (unsigned)s_fail_run);
+}
+
+bool i2c_health_ok() { return !s_down; }
+bool i2c_health_busy() { return s_recover.running(); }
+
+uint32_t i2c_health_wait_ms() {
+  if (!s_down) return 0;
+  const int32_t left = (int32_t)(s_next_try_ms - millis());
+  return left > 0 ? (uint32_t)left : 0;
+}
+
+void i2c_health_service() {
+  if (!s_down || (int32_t)(millis() - s_next_try_ms) < 0) return;
+  if (!s_recover.running()) s_attempts++;
+  const CoRc rc = i2c_bus_recover_co(s_recover);
+  if (rc == CoRc::WAIT) { s_next_try_ms = s_recover.wake_ms; return; }
+  bool ok = rc == CoRc::DONE;
+  if (ok && s_reinit) ok = s_reinit();
+
+  const uint32_t now = millis();
+  if (!ok) {
+    s_next_try_ms = now + s_backoff_ms;
+    Serial.printf("[i2c] recovery attempt %u failed; retry in %lu ms\n", (unsigned)s_attempts, (unsigned long)s_backoff_ms);
+    s_backoff_ms = (s_backoff_ms * 2 > I2C_HEALTH_BACKOFF_MAX_MS) ? I2C_HEALTH_BACKOFF_MAX_MS : s_backoff_ms * 2;
+    return;
+  }
+  const uint32_t outage = now - s_down_since_ms;
+  s_outages++;
+  s_outage_total_ms += outage;
+  if (outage > s_outage_max_ms) s_outage_max_ms = outage;
+  s_down = false;
+  s_fail_run = 0;
+  Serial.printf("[i2c] bus recovered after %lu ms outage (%u attempt%s)\n",
+                (unsigned long)outage, (unsigned)s_attempts, s_attempts == 1 ? "" : "s");
+}
+
+void i2c_health_print(Stream& out) {
+  if (s_down)
+    out.printf("[i2c] health: DOWN for %lu ms, %u attempts, next in %lu ms\n",
+               (unsigned long)(millis() - s_down_since_ms), (unsigned)s_attempts, (unsigned long)i2c_health_wait_ms());
+  else
+    out.printf("[i2c] health: ok  outages=%lu total=%lu ms longest=%lu ms\n",
+               (unsigned long)s_outages, (unsigned long)s_outage_total_ms, (unsigned long)s_outage_max_ms);
+}
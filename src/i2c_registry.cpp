@@ -0,0 +1,111 @@
+// src/i2c_registry.cpp
+#include "i2c_registry.h"
+#include <Arduino.h>
+
+static I2cKnownDevice s_known[] = {
+  { 0x24, "CH422G", false, false, 0 },
+  { 0x5D, "GT911",  false, false, 0 },
+  { 0x14, "GT911",  false, false, 0 },
+  { 0x38, "FT6x36", false, false, 0 },
+  { 0x15, "CST816", false, false, 0 },
+};
+static constexpr size_t KNOWN_N = sizeof(s_known) / sizeof(s_known[0]);
+static constexpr uint8_t I2C_SCAN_CHUNK = 8;   // addresses per bus job (~1 ms at 100 kHz)
+
+static uint32_t s_present[4] = {};   // 128-bit map from the last full scan
+static bool     s_scanned = false;
+static uint32_t s_scan_ms = 0;
+static uint16_t s_scan_count = 0;
+
+static inline void set_bit(uint8_t a, bool v) {
+  if (v) s_present[a >> 5] |= (1u << (a & 31));
+  else   s_present[a >> 5] &= ~(1u << (a & 31));
+}
+static inline bool get_bit(uint8_t a) { return (s_present[a >> 5] >> (a & 31)) & 1u; }
+
+static I2cKnownDevice* find_known(uint8_t addr) {
+  for (auto& d : s_known) if (d.addr == addr) return &d;
+  return nullptr;
+}
+
+void i2c_registry_scan() {
+  const uint32_t t0 = millis();
+  // One BACKGROUND job per chunk, so queued touch samples run in between
+  for (uint8_t a0 = 1; a0 < 127; a0 += I2C_SCAN_CHUNK) {
+    (void)i2c_bus_call(I2cClient::DIAG, I2cPrio::BACKGROUND, [a0]{
+      for (uint8_t a = a0; a < 127 && a < a0 + I2C_SCAN_CHUNK; ++a) {
+        set_bit(a, i2c_raw_probe(a) == I2cRc::OK);
+      }
+      return true;
+    });
+  }
+  s_scanned = true;
+  s_scan_ms = millis();
+  s_scan_count++;
+  for (auto& d : s_known) {
+    d.present = get_bit(d.addr);
+    d.alive = d.present;
+    d.checked_ms = s_scan_ms;
+  }
+  Serial.printf("[i2c] full scan #%u in %lu ms\n", (unsigned)s_scan_count, (unsigned long)(s_scan_ms - t0));
+}
+
+bool i2c_registry_scanned() { return s_scanned; }
+
+bool i2c_registry_present(uint8_t addr) { return addr < 128 && get_bit(addr); }
+
+bool i2c_registry_check(uint8_t addr) {
+  const bool ok = i2c_probe(addr);
+  if (I2cKnownDevice* d = find_known(addr)) {
+    if (d->alive != ok && d->checked_ms)
+      Serial.printf("[i2c] %s @0x%02X %s\n", d->name, addr, ok ? "back" : "LOST");
+    d->alive = ok;
+    if (ok) d->present = true;        // targeted discovery when no full scan ran
+    d->checked_ms = millis();
+  }
+  return ok;
+}
+
+void i2c_registry_check_known() {
+  for (auto& d : s_known) if (d.present || !s_scanned) (void)i2c_registry_check(d.addr);
+}
+
+const I2cKnownDevice* i2c_registry_known(size_t& count) { count = KNOWN_N; return s_known; }
+
+size_t i2c_registry_format(char* buf, size_t len, const char* tag) {
+  size_t n = 0;
+  auto put = [&](const char* fmt, auto... args) {
+    if (n < len) {
+      const int w = snprintf(buf + n, len - n, fmt, args...);
+      if (w > 0) n += (size_t)w;
+    }
+  };
+  put("I2C %s:\n", tag ? tag : "");
+  int col = 0;
+  bool any = false;
+  for (uint8_t a = 1; a < 127; ++a) {
+    if (!get_bit(a)) continue;
+    put("0x%02X ", a);
+    any = true;
+    if (++col >= 12) { put("\n"); col = 0; }
+  }
+  if (!any) put(s_scanned ? "(none)" : "(not scanned)");
+  for (const auto& d : s_known) {
+    if (!d.present) continue;
+    put("\n%s @0x%02X %s", d.name, d.addr, d.alive ? "ok" : "LOST");
+  }
+  return n < len ? n : (len ? len - 1 : 0);
+}
+
+void i2c_registry_print(Stream& out) {
+  out.print(F("I2C scan:"));
+  bool any = false;
+  for (uint8_t a = 1; a < 127; ++a) if (get_bit(a)) { out.printf(" 0x%02X", a); any = true; }
+  if (!any) out.print(F(" (none)"));
+  out.println();
+  for (const auto& d : s_known) {
+    if (!d.present) continue;
+    out.printf("  %-7s 0x%02X  %s  (checked %lu ms ago)\n", d.name, d.addr, d.alive ? "alive" : "LOST",
+               (unsigned long)(millis() - d.checked_ms));
+  }
+}
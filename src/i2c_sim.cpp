@@ -0,0 +1,245 @@
+// src/i2c_sim.cpp
+#include "i2c_sim.h"
+#include <string.h>
+
+// Host builds always get the simulator; firmware only with I2C_BACKEND_SIM=1
+#if !defined(ARDUINO) || (defined(I2C_BACKEND_SIM) && I2C_BACKEND_SIM)
+
+// -------- GT911 --------
+struct Gt911Model {
+  static constexpr uint16_t BASE = 0x8040, END = 0x8200;
+  static constexpr uint16_t CFG = 0x8047, CHK = 0x80FF, FRESH = 0x8100;
+  static constexpr uint16_t PID = 0x8140, STATUS = 0x814E, POINTS = 0x8150;
+  static constexpr size_t   CFG_LEN = CHK - CFG;   // 184
+
+  bool     on = false;
+  uint8_t  addr = 0x5D;
+  uint16_t ptr = 0;
+  uint8_t  mem[END - BASE];
+  uint8_t  stored[CFG_LEN + 1];                     // "flash" copy incl. checksum
+  bool     pressed = false, release_pending = false;
+  uint16_t x = 0, y = 0;
+
+  uint8_t* at(uint16_t reg) { return (reg >= BASE && reg < END) ? &mem[reg - BASE] : nullptr; }
+
+  static uint8_t checksum(const uint8_t* cfg) {
+    uint8_t sum = 0;
+    for (size_t i = 0; i < CFG_LEN; ++i) sum += cfg[i];
+    return uint8_t(~sum + 1);
+  }
+
+  void init(uint8_t a) {
+    on = true; addr = a; ptr = 0;
+    memset(mem, 0, sizeof(mem));
+    uint8_t* c = at(CFG);
+    c[0] = 'A';
+    c[1] = 0x20; c[2] = 0x03;          // 800
+    c[3] = 0xE0; c[4] = 0x01;          // 480
+    c[5] = 0x05;                       // 5 touch points
+    c[6] = 0x0D;                       // module switch 1
+    c[12] = 0x50; c[13] = 0x3C;        // touch / leave level
+    c[15] = 0x05;                      // report every 10 ms
+    c[CFG_LEN] = checksum(c);
+    memcpy(stored, c, sizeof(stored));
+    memcpy(at(PID), "911\0", 4);
+    at(PID + 4)[0] = 0x60; at(PID + 5)[0] = 0x10;   // firmware 0x1060
+    pressed = release_pending = false;
+  }
+
+  void reset(bool int_high) {
+    addr = int_high ? 0x14 : 0x5D;
+    ptr = 0;
+    memcpy(at(CFG), stored, sizeof(stored));
+    *at(FRESH) = 0; *at(STATUS) = 0;
+  }
+
+  void apply_config() {
+    const uint8_t* c = at(CFG);
+    const bool ok = c[CFG_LEN] == checksum(c) && c[0] >= stored[0];
+    if (ok) memcpy(stored, c, sizeof(stored));
+    else    memcpy(at(CFG), stored, sizeof(stored));
+    *at(FRESH) = 0;
+  }
+
+  // A report is latched when the host looks at an empty status register
+  void publish() {
+    uint8_t* st = at(STATUS);
+    if ((*st & 0x80) || (!pressed && !release_pending)) return;
+    memset(at(POINTS), 0, 8);
+    if (pressed) {
+      uint8_t* p = at(POINTS);
+      p[0] = uint8_t(x); p[1] = uint8_t(x >> 8);
+      p[2] = uint8_t(y); p[3] = uint8_t(y >> 8);
+      p[4] = 0x20;                                   // size
+      *st = 0x81;
+    } else {
+      *st = 0x80;
+      release_pending = false;
+    }
+  }
+
+  void write(const uint8_t* w, size_t n) {
+    if (n < 2) return;
+    ptr = uint16_t((w[0] << 8) | w[1]);
+    for (size_t i = 2; i < n; ++i) {
+      const uint16_t reg = uint16_t(ptr + i - 2);
+      if (uint8_t* m = at(reg)) *m = w[i];
+      if (reg == FRESH && w[i] == 1) apply_config();
+    }
+  }
+
+  void read(uint8_t* r, size_t n) {
+    if (ptr <= STATUS && ptr + n > STATUS) publish();
+    for (size_t i = 0; i < n; ++i) {
+      const uint8_t* m = at(uint16_t(ptr + i));
+      r[i] = m ? *m : 0;
+    }
+  }
+};
+
+// -------- FT6x36 --------
+struct Ft6x36Model {
+  static constexpr uint8_t ADDR = 0x38;
+  bool    on = false;
+  uint8_t ptr = 0;
+  uint8_t regs[256];
+
+  void init() {
+    on = true; ptr = 0;
+    memset(regs, 0, sizeof(regs));
+    regs[0x80] = 0x16;     // threshold
+    regs[0xA3] = 0x11;     // VENDID (FocalTech)
+    regs[0xA6] = 0x10;     // firmware
+    regs[0xA8] = 0x36;     // CHIPID
+  }
+  void touch(bool pressed, uint16_t x, uint16_t y) {
+    regs[0x02] = pressed ? 1 : 0;
+    regs[0x03] = uint8_t((pressed ? 0x80 : 0x40) | ((x >> 8) & 0x0F));   // event: contact / lift-up
+    regs[0x04] = uint8_t(x);
+    regs[0x05] = uint8_t((y >> 8) & 0x0F);
+    regs[0x06] = uint8_t(y);
+  }
+  void write(const uint8_t* w, size_t n) {
+    if (!n) return;
+    ptr = w[0];
+    for (size_t i = 1; i < n; ++i) regs[uint8_t(ptr + i - 1)] = w[i];
+  }
+  void read(uint8_t* r, size_t n) {
+    for (size_t i = 0; i < n; ++i) r[i] = regs[uint8_t(ptr + i)];
+  }
+};
+
+// -------- CH422G --------
+struct Ch422gModel {
+  static constexpr uint8_t WR_SET = 0x24, WR_OC = 0x23, RD_IO = 0x26, WR_IO = 0x38;
+  bool    on = false;
+  uint8_t set = 0, io = 0xFF, oc = 0, inputs = 0xFF;
+  int8_t  gt_int = -1, gt_rst = -1;
+  bool    rst_level = true;
+
+  static bool owns(uint8_t a) { return a == WR_SET || a == WR_OC || a == RD_IO || a == WR_IO; }
+  uint8_t pins() const { return (set & 0x01) ? io : inputs; }
+};
+
+// -------- Bus state --------
+static Gt911Model  s_gt;
+static Ft6x36Model s_ft;
+static Ch422gModel s_ch;
+
+static uint32_t    s_hz = 100000;
+static I2cSimStats s_stats;
+static uint8_t     s_nack_addr = 0;
+static uint16_t    s_nack_every = 0, s_nack_count = 0;
+static uint16_t    s_stuck_pulses = 0;     // > 0: SDA held low until this many pulses
+static uint32_t    s_latency_us = 0;
+static void      (*s_delay_fn)(uint32_t) = nullptr;
+
+static void ch422g_pins_changed() {
+  if (!s_gt.on || s_ch.gt_rst < 0) return;
+  const uint8_t p = s_ch.pins();
+  const bool rst = (p >> s_ch.gt_rst) & 1;
+  if (rst && !s_ch.rst_level) s_gt.reset((p >> s_ch.gt_int) & 1);   // address latched on RST rising
+  s_ch.rst_level = rst;
+}
+
+void i2c_sim_reset() {
+  s_gt = Gt911Model{};
+  s_ft = Ft6x36Model{};
+  s_ch = Ch422gModel{};
+  s_hz = 100000;
+  s_stats = I2cSimStats{};
+  s_nack_addr = 0; s_nack_every = 0; s_nack_count = 0;
+  s_stuck_pulses = 0;
+  s_latency_us = 0;
+}
+
+void i2c_sim_add_gt911(uint8_t addr) { s_gt.init(addr); }
+void i2c_sim_add_ft6x36() { s_ft.init(); }
+void i2c_sim_add_ch422g() { s_ch = Ch422gModel{}; s_ch.on = true; }
+void i2c_sim_wire_gt911_reset(uint8_t exio_int, uint8_t exio_rst) {
+  s_ch.gt_int = (int8_t)exio_int; s_ch.gt_rst = (int8_t)exio_rst;
+}
+
+void i2c_sim_touch(bool pressed, uint16_t x, uint16_t y) {
+  if (s_gt.pressed && !pressed) s_gt.release_pending = true;
+  s_gt.pressed = pressed; s_gt.x = x; s_gt.y = y;
+  if (s_ft.on) s_ft.touch(pressed, x, y);
+}
+
+void i2c_sim_ch422g_inputs(uint8_t levels) { s_ch.inputs = levels; }
+
+I2cSimRc i2c_sim_xfer(uint8_t addr, const uint8_t* w, size_t wn, uint8_t* r, size_t rn) {
+  s_stats.transfers++;
+  const size_t bytes = 1 + wn + (wn && rn ? 1 : 0) + rn;    // address byte(s) + data
+  s_stats.bytes += (uint32_t)bytes;
+  s_stats.bus_time_us += (uint64_t)bytes * 9u * 1000000u / s_hz + s_latency_us;
+  if (s_latency_us && s_delay_fn) s_delay_fn(s_latency_us);
+
+  if (s_stuck_pulses) { s_stats.timeouts++; return I2cSimRc::TIMEOUT; }
+  if (s_nack_every && addr == s_nack_addr && (++s_nack_count % s_nack_every) == 0) {
+    s_stats.nacks++;
+    return I2cSimRc::NACK;
+  }
+
+  if (s_ch.on && Ch422gModel::owns(addr)) {
+    if (addr == Ch422gModel::RD_IO) {
+      for (size_t i = 0; i < rn; ++i) r[i] = s_ch.pins();
+      return I2cSimRc::OK;
+    }
+    if (wn) {
+      if (addr == Ch422gModel::WR_SET) s_ch.set = w[0];
+      else if (addr == Ch422gModel::WR_IO) s_ch.io = w[0];
+      else s_ch.oc = w[0];
+      ch422g_pins_changed();
+    }
+    return I2cSimRc::OK;
+  }
+  if (s_gt.on && addr == s_gt.addr) {
+    if (wn) s_gt.write(w, wn);
+    if (rn) s_gt.read(r, rn);
+    return I2cSimRc::OK;
+  }
+  if (s_ft.on && addr == Ft6x36Model::ADDR) {
+    if (wn) s_ft.write(w, wn);
+    if (rn) s_ft.read(r, rn);
+    return I2cSimRc::OK;
+  }
+  s_stats.nacks++;
+  return I2cSimRc::NACK;
+}
+
+void i2c_sim_set_clock(uint32_t hz) { if (hz) s_hz = hz; }
+
+bool i2c_sim_clock_pulses(unsigned n) {
+  if (s_stuck_pulses) s_stuck_pulses = (n >= s_stuck_pulses) ? 0 : uint16_t(s_stuck_pulses - n);
+  return s_stuck_pulses == 0;
+}
+
+void i2c_sim_fault_nack(uint8_t addr, uint16_t every_n) { s_nack_addr = addr; s_nack_every = every_n; s_nack_count = 0; }
+void i2c_sim_fault_stuck_sda(uint16_t release_after_pulses) { s_stuck_pulses = release_after_pulses; }
+void i2c_sim_fault_latency(uint32_t us) { s_latency_us = us; }
+void i2c_sim_set_delay_fn(void (*fn)(uint32_t)) { s_delay_fn = fn; }
+
+const I2cSimStats& i2c_sim_stats() { return s_stats; }
+
+#endif
@@ -0,0 +1,131 @@
+// src/i2c_trace.cpp
+#include "i2c_trace.h"
+#include "i2c_bus.h"
+#include <Arduino.h>
+#include <lvgl.h>
+#include <string.h>
+
+struct TraceEntry {
+  uint32_t t_us;
+  uint32_t dur_us;
+  uint16_t reg;
+  uint16_t len;
+  uint8_t  addr;
+  uint8_t  op;
+  uint8_t  ok;
+  uint8_t  pad;
+};
+
+// log2 buckets: [0]=<16us, [1]=16-31, ... [HIST_N-1]=>=16*2^(HIST_N-2) us
+static constexpr int HIST_N = 12;
+struct DeviceStats {
+  uint8_t  addr;
+  uint32_t count, errors;
+  uint64_t busy_us;
+  uint32_t max_us;
+  uint32_t hist[HIST_N];
+};
+
+static bool        s_on = false;
+static TraceEntry  s_ring[I2C_TRACE_DEPTH];
+static uint32_t    s_n = 0;               // total recorded (ring index = s_n % depth)
+static DeviceStats s_dev[I2C_TRACE_DEVICES];
+static uint8_t     s_dev_n = 0;
+static uint32_t    s_overflow = 0;        // transfers to addresses beyond I2C_TRACE_DEVICES
+static uint32_t    s_t_start = 0;
+
+static const char* const kOpName[] = { "probe", "read", "write", "exio" };
+
+static inline int bucket(uint32_t us) {
+  int b = 0;
+  for (us >>= 4; us && b < HIST_N - 1; us >>= 1) b++;
+  return b;
+}
+
+static DeviceStats* dev_for(uint8_t addr) {
+  for (uint8_t i = 0; i < s_dev_n; ++i) if (s_dev[i].addr == addr) return &s_dev[i];
+  if (s_dev_n >= I2C_TRACE_DEVICES) return nullptr;
+  DeviceStats* d = &s_dev[s_dev_n++];
+  memset(d, 0, sizeof(*d));
+  d->addr = addr;
+  return d;
+}
+
+// Recording runs on the bus task; clearing and the dump snapshot go through it too
+void i2c_trace_enable(bool on) {
+  (void)i2c_bus_call(I2cClient::DIAG, I2cPrio::NORMAL, [on]{
+    if (on) {
+      s_n = 0; s_dev_n = 0; s_overflow = 0;
+      s_t_start = micros();
+    }
+    s_on = on;
+    return true;
+  });
+  Serial.printf("[i2c-trace] %s\n", on ? "on (cleared)" : "off");
+}
+
+bool i2c_trace_enabled() { return s_on; }
+
+void i2c_trace_record(I2cOp op, uint8_t addr, uint16_t reg, uint16_t len, bool ok, uint32_t t0_us) {
+  if (!s_on) return;
+  const uint32_t dur = micros() - t0_us;
+  s_ring[s_n % I2C_TRACE_DEPTH] = { t0_us, dur, reg, len, addr, (uint8_t)op, (uint8_t)ok, 0 };
+  s_n++;
+  DeviceStats* d = dev_for(addr);
+  if (!d) { s_overflow++; return; }
+  d->count++;
+  if (!ok) d->errors++;
+  d->busy_us += dur;
+  if (dur > d->max_us) d->max_us = dur;
+  d->hist[bucket(dur)]++;
+}
+
+struct TraceSnap {
+  bool        on;
+  uint32_t    n, overflow, wall;
+  uint8_t     dev_n;
+  DeviceStats dev[I2C_TRACE_DEVICES];
+  TraceEntry  last[I2C_TRACE_DUMP_LAST];   // oldest first
+};
+
+void i2c_trace_dump(Stream& out) {
+  static TraceSnap sn;   // ui task only; too big for its stack
+  (void)i2c_bus_call(I2cClient::DIAG, I2cPrio::NORMAL, []{
+    sn.on = s_on; sn.n = s_n; sn.overflow = s_overflow; sn.wall = micros() - s_t_start;
+    sn.dev_n = s_dev_n;
+    memcpy(sn.dev, s_dev, s_dev_n * sizeof(DeviceStats));
+    const uint32_t n = s_n < I2C_TRACE_DUMP_LAST ? s_n : I2C_TRACE_DUMP_LAST;
+    for (uint32_t k = 0; k < n; ++k) sn.last[k] = s_ring[(s_n - n + k) % I2C_TRACE_DEPTH];
+    return true;
+  });
+
+  const uint32_t wall = sn.wall;
+  out.printf("[i2c-trace] %s, %lu transfers over %lu ms\n", sn.on ? "on" : "off",
+             (unsigned long)sn.n, (unsigned long)(wall / 1000));
+  if (!sn.n) return;
+
+  out.print(F("  addr   count  err   busy ms  bus %   avg us  max us  | <16 <32 <64 <128 <256 <512 <1k <2k <4k <8k <16k more\n"));
+  uint64_t busy_all = 0;
+  for (uint8_t i = 0; i < sn.dev_n; ++i) {
+    const DeviceStats& d = sn.dev[i];
+    busy_all += d.busy_us;
+    out.printf("  0x%02X %7lu %4lu %9.1f %6.2f %8lu %7lu  |", d.addr, (unsigned long)d.count, (unsigned long)d.errors,
+               d.busy_us / 1000.0, wall ? d.busy_us * 100.0 / wall : 0.0,
+               (unsigned long)(d.count ? d.busy_us / d.count : 0), (unsigned long)d.max_us);
+    for (int b = 0; b < HIST_N; ++b) out.printf(" %lu", (unsigned long)d.hist[b]);
+    out.println();
+  }
+  out.printf("  bus busy %.2f%% (%.2f ms per %u ms frame)%s\n", wall ? busy_all * 100.0 / wall : 0.0,
+             wall ? busy_all * (double)LV_DEF_REFR_PERIOD / wall : 0.0, (unsigned)LV_DEF_REFR_PERIOD,
+             sn.overflow ? "  [some addresses untracked]" : "");
+
+  // Most recent transfers, oldest first
+  const uint32_t n = sn.n < I2C_TRACE_DUMP_LAST ? sn.n : I2C_TRACE_DUMP_LAST;
+  const uint32_t kept = sn.n < I2C_TRACE_DEPTH ? sn.n : I2C_TRACE_DEPTH;
+  out.printf("  last %lu of %lu kept:\n", (unsigned long)n, (unsigned long)kept);
+  for (uint32_t k = 0; k < n; ++k) {
+    const TraceEntry& e = sn.last[k];
+    out.printf("  %10lu us  0x%02X %-5s reg=0x%04X len=%-3u %5lu us %s\n", (unsigned long)e.t_us, e.addr,
+               kOpName[e.op], e.reg, e.len, (unsigned long)e.dur_us, e.ok ? "ok" : "FAIL");
+  }
+}
@@ -0,0 +1,88 @@
+// src/latency_trace.cpp
+#include "latency_trace.h"
+#include <Arduino.h>
+#include <lvgl.h>
+#include <algorithm>
+
+enum : uint8_t { ST_EVENT=0, ST_RENDER, ST_FLUSH, ST_TOTAL, ST_COUNT };
+static const char* const kStageName[ST_COUNT] = { "sample->event", "event->render", "render->flush", "total" };
+
+struct Pending {
+  bool      active;
+  uint32_t  t_sample, t_event, t_render;
+  lv_area_t area;
+};
+
+// A handful in flight is plenty: events that land in the same frame share a flush
+static constexpr int LAT_PENDING = 4;
+static Pending  s_pend[LAT_PENDING];
+static uint32_t s_last_sample_us = 0;
+
+static uint32_t s_hist[ST_COUNT][LAT_MAX_SAMPLES];
+static uint32_t s_n = 0;          // completed traces (total, may exceed LAT_MAX_SAMPLES)
+static uint32_t s_dropped = 0;
+
+static void render_start_cb(lv_event_t*) {
+  const uint32_t now = micros();
+  for (auto& p : s_pend) if (p.active && p.t_render == 0) p.t_render = now;
+}
+
+void lat_attach(lv_display_t* disp) {
+  if (disp) lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, nullptr);
+}
+
+void lat_input_sample(uint32_t t_us) { s_last_sample_us = t_us; }
+
+void lat_event(const lv_obj_t* affected) {
+  if (!affected || s_last_sample_us == 0) return;   // serial/simulated changes have no sample
+  const uint32_t now = micros();
+  Pending* slot = nullptr;
+  for (auto& p : s_pend) {
+    if (p.active && now - p.t_event > LAT_PENDING_TIMEOUT_US) { p.active = false; s_dropped++; }
+    if (!p.active && !slot) slot = &p;
+  }
+  if (!slot) { s_dropped++; return; }
+  slot->active   = true;
+  slot->t_sample = s_last_sample_us;
+  slot->t_event  = now;
+  slot->t_render = 0;
+  lv_obj_get_coords(affected, &slot->area);
+}
+
+void lat_flush(const lv_area_t* area) {
+  const uint32_t now = micros();
+  for (auto& p : s_pend) {
+    if (!p.active || p.t_render == 0) continue;
+    lv_area_t common;
+    if (!lv_area_intersect(&common, &p.area, area)) continue;
+    const uint32_t i = s_n % LAT_MAX_SAMPLES;
+    s_hist[ST_EVENT ][i] = p.t_event  - p.t_sample;
+    s_hist[ST_RENDER][i] = p.t_render - p.t_event;
+    s_hist[ST_FLUSH ][i] = now        - p.t_render;
+    s_hist[ST_TOTAL ][i] = now        - p.t_sample;
+    s_n++;
+    p.active = false;
+  }
+}
+
+void lat_reset() {
+  for (auto& p : s_pend) p.active = false;
+  s_n = 0; s_dropped = 0;
+}
+
+void lat_report(Stream& out) {
+  const uint32_t n = (s_n < LAT_MAX_SAMPLES) ? s_n : LAT_MAX_SAMPLES;
+  out.printf("[lat] %lu traces (%lu kept), %lu dropped\n",
+             (unsigned long)s_n, (unsigned long)n, (unsigned long)s_dropped);
+  if (n == 0) return;
+
+  static uint32_t sorted[LAT_MAX_SAMPLES];
+  for (int st = 0; st < ST_COUNT; ++st) {
+    std::copy(s_hist[st], s_hist[st] + n, sorted);
+    std::sort(sorted, sorted + n);
+    auto pct = [&](uint32_t p) { return sorted[(n - 1) * p / 100]; };
+    out.printf("[lat] %-14s p50=%6lu us  p95=%6lu us  p99=%6lu us  max=%6lu us\n", kStageName[st],
+               (unsigned long)pct(50), (unsigned long)pct(95), (unsigned long)pct(99),
+               (unsigned long)sorted[n - 1]);
+  }
+}
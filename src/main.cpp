@@ -14,25 +14,50 @@
 #include <esp_heap_caps.h>
 #include <esp_timer.h>
 
-#include <esp_io_expander.hpp>
-using namespace esp_expander;
-
 #include <databus/Arduino_ESP32RGBPanel.h>
 #include <display/Arduino_RGB_Display.h>
 
 #include <lvgl.h>
 #include "touch_input.h"
+#include "touch_trace.h"
+#include "latency_trace.h"
+#include "touch_calib.h"
+#include "ch422g.h"
+#include "i2c_registry.h"
+#include "i2c_clock.h"
+#include "i2c_trace.h"
+#include "boot_profile.h"
+#include "hw_cache.h"
+#include "splash.h"
+#include "app_tasks.h"
+#include "app_model.h"
+#include "cpu_monitor.h"
+#include "power_mgmt.h"
+#include "screen_power.h"
+#include "rtc_state.h"
+#include "coseq.h"
+#if I2C_BACKEND_SIM
+#include "i2c_sim.h"
+#endif
 
 /* ------------------------- Pins / I2C ------------------------- */
 static constexpr int I2C_SDA  = 8;
 static constexpr int I2C_SCL  = 9;
 
 /* ------------------------- CH422G ----------------------------- */
-static constexpr int I2C_PORT = 0;
-static CH422G *exio = nullptr;
+// Shadowed in ch422g.cpp: pin changes are staged and sent by ch422g_commit()
 static bool exio_ok = false;
 static constexpr int EXIO_BL = 2;
 
+static void backlight_set(bool on) {
+  if (!exio_ok) return;
+  ch422g_write(EXIO_BL, on ? HIGH : LOW);
+  ch422g_commit();
+  Serial.printf("[exio] EXIO2 -> %s (BL %s), %lu expander writes so far\n", on ? "HIGH" : "LOW",
+                on ? "on" : "off", (unsigned long)ch422g_write_count());
+}
+static void backlight_on() { backlight_set(true); }
+
 /* -------------------- (Optional) drive strength --------------- */
 #include "driver/gpio.h"
 static inline void boost_rgb_drive() {
@@ -64,16 +89,8 @@ Arduino_ESP32RGBPanel *rgbpanel = new Arduino_ESP32RGBPanel(
 Arduino_RGB_Display *gfx = new Arduino_RGB_Display(800, 480, rgbpanel, 0, false);
 
 /* ------------------------------ App Model ------------------------------ */
-enum class PlayPreset : uint8_t { None=0, WhiteNoise, Rain, Heartbeat, Lullaby };
-static struct {
-  uint8_t  soundLevel;         // 0..100 (simulated)
-  bool     cryLikely;
-  bool     motion;
-  uint32_t lastMotionMs;
-  PlayPreset playing;
-  uint8_t  volume;             // 0..100
-  uint8_t  cryThresh;          // threshold (sim)
-} g = {0,false,false,0, PlayPreset::None, 60, 65};
+/* ui task's working copy; other tasks read app_model_read() snapshots */
+static AppModel g = {0,false,false,0, PlayPreset::None, 60, 65};
 
 /* ----------------------------- LVGL glue ------------------------------ */
 static lv_display_t* disp;
@@ -211,13 +228,35 @@ static void ui_refresh_all() {
   update_now_playing();
 }
 
+/* Every model change ends here: seqlock snapshot for other tasks; user changes
+   also nudge the net task (a dropped nudge is fine, the next one reads everything) */
+static void model_commit(bool user_change) {
+  app_model_publish(g);
+  rtc_state_save(g, screen_asleep() ? RtcScreen::MAIN_DARK : RtcScreen::MAIN);
+  if (user_change) (void)net_post(NetMsg{ app_model_version() });
+}
+static void publish_state() { model_commit(true); }
+
 /* ------------------------- Events ------------------------- */
-static void on_play(lv_event_t*) { if (g.playing == PlayPreset::None) g.playing = PlayPreset::WhiteNoise; ui_refresh_all(); }
-static void on_stop(lv_event_t*) { g.playing = PlayPreset::None; ui_refresh_all(); }
+/* e == nullptr when driven from Serial; only touch-driven events are latency-traced */
+static void on_play(lv_event_t* e) {
+  if (g.playing == PlayPreset::None) g.playing = PlayPreset::WhiteNoise;
+  ui_refresh_all();
+  publish_state();
+  if (e) lat_event(nowPlayingLabel);
+}
+static void on_stop(lv_event_t* e) {
+  g.playing = PlayPreset::None;
+  ui_refresh_all();
+  publish_state();
+  if (e) lat_event(nowPlayingLabel);
+}
 static void on_volume(lv_event_t* e) {
   g.volume = clamp100(lv_slider_get_value((lv_obj_t*)lv_event_get_target(e)));
   char vv[24]; snprintf(vv, sizeof(vv), "%u%%", (unsigned)g.volume);
   lv_label_set_text(volumeValueLabel, vv);
+  publish_state();
+  lat_event(volumeValueLabel);
 }
 
 /* ------------------------- Build UI ------------------------- */
@@ -285,88 +324,231 @@ static void build_ui() {
   ui_refresh_all();
 }
 
-/* ------------------------------- Serial ------------------------------- */
-static void handleSerial() {
-  while (Serial.available()) {
-    char c = (char)Serial.read();
-    switch (c) {
-      case 'p': on_play(nullptr); break;
-      case 'x': on_stop(nullptr); break;
-      case '+': g.volume = clamp100(g.volume+5); update_now_playing(); break;
-      case '-': g.volume = clamp100(g.volume-5); update_now_playing(); break;
-      case 'w': g.cryThresh = clamp100(g.cryThresh+2); break;
-      case 's': g.cryThresh = clamp100(g.cryThresh-2); break;
-      default: break;
-    }
-  }
-}
-
-/* -------- I2C scan helper: multi-line -------- */
+/* -------- I2C scan box (rendered from the device registry) -------- */
 static void scan_set(const char* s) { if (scanBox) lv_label_set_text(scanBox, s); }
-static void i2c_scan_multiline(const char* tag) {
-  String out; out.reserve(256);
-  out += "I2C "; out += (tag ? tag : ""); out += ":\n";
-  int col = 0;
-  for (uint8_t a = 1; a < 127; ++a) {
-    Wire.beginTransmission(a);
-    if (Wire.endTransmission() == 0) {
-      char buf[8];
-      snprintf(buf, sizeof(buf), "0x%02X ", a);
-      out += buf; col++; if (col >= 12) { out += "\n"; col = 0; }
-    }
-  }
-  if (col == 0 && out.indexOf('\n') == (int)out.length()-1) { out += "(none)"; }
+static void i2c_scan_show(const char* tag) {
+  char out[384];
+  i2c_registry_format(out, sizeof(out), tag);
   Serial.println(out);
-  scan_set(out.c_str());
+  scan_set(out);
 }
 
-/* ---------------------- GT911 reset via CH422G ------------------------ */
-static bool gt_reset_seq(int exio_int, int exio_rst) {
-  if (!exio_ok) return false;
-  exio->pinMode(exio_int, OUTPUT);
-  exio->pinMode(exio_rst, OUTPUT);
-  exio->digitalWrite(exio_int, HIGH);
-  exio->digitalWrite(exio_rst, HIGH);
-  delay(2);
-
-  exio->digitalWrite(exio_int, LOW);
-  delay(1);
-
-  exio->digitalWrite(exio_rst, LOW);  delay(10);
-  exio->digitalWrite(exio_rst, HIGH); delay(10);
+/* -------- Diag label: status text, or the CPU monitor summary ('U') -------- */
+static bool s_cpu_panel = CPU_MON_PANEL;
+static char s_diag_text[64] = "diag: ready";
+static void diag_set(const char* s) {
+  snprintf(s_diag_text, sizeof(s_diag_text), "%s", s);
+  if (diagLabel && !s_cpu_panel) lv_label_set_text(diagLabel, s_diag_text);
+}
+static void cpu_panel_show() {
+  char buf[96];
+  cpu_mon_format(buf, sizeof(buf));
+  lv_label_set_text(diagLabel, buf);
+}
+static void cpu_mon_timer(lv_timer_t*) {
+  cpu_mon_update();
+  if (diagLabel && s_cpu_panel) cpu_panel_show();
+}
+static void cpu_panel_toggle() {
+  s_cpu_panel = !s_cpu_panel;
+  if (!diagLabel) return;
+  if (s_cpu_panel) cpu_panel_show();
+  else lv_label_set_text(diagLabel, s_diag_text);
+}
 
-  exio->pinMode(exio_int, INPUT);
-  exio->digitalWrite(exio_rst, HIGH);
+/* ---------------------- GT911 reset via CH422G ------------------------ */
+struct GtResetCtx { uint8_t exio_int, exio_rst; bool ack; };
 
-  delay(20);
+static bool gt_probe_5d() {
+  // raw probe: the NACKs while the controller boots must not count as bus failures
+  return i2c_bus_call(I2cClient::EXPANDER, I2cPrio::NORMAL, []{ return i2c_raw_probe(0x5D) == I2cRc::OK; });
+}
 
-  Wire.beginTransmission(0x5D);
-  bool ok = (Wire.endTransmission() == 0);
-  Serial.printf("[*] GT911 reset via CH422G: INT=EXIO%d RST=EXIO%d -> %s\n",
-                exio_int, exio_rst, ok ? "0x5D ACK" : "NO ACK");
-  return ok;
+// Coroutine (coseq.h): blocking inside one bus job at boot, on LVGL timers for 'G'
+static CoRc gt_reset_co(CoSeq& co, GtResetCtx& c) {
+  CO_BEGIN(co);
+  if (!exio_ok) CO_RETURN(co, false);
+  {
+    const uint8_t m = uint8_t((1u << c.exio_int) | (1u << c.exio_rst));
+    // INT+RST high together: one WR_IO (+ WR_SET if the bank was still input)
+    ch422g_pin_mode(c.exio_int, OUTPUT);
+    ch422g_pin_mode(c.exio_rst, OUTPUT);
+    ch422g_write_mask(m, m);
+    ch422g_commit();
+  }
+  CO_SLEEP_MS(co, 2);
+
+  ch422g_write(c.exio_int, LOW);  ch422g_commit();
+  CO_SLEEP_MS(co, 1);
+  ch422g_write(c.exio_rst, LOW);  ch422g_commit();
+  CO_SLEEP_MS(co, 10);
+  ch422g_write(c.exio_rst, HIGH); ch422g_commit();
+  CO_SLEEP_MS(co, 10);
+
+  // Release INT (held high) with RST high in the same write
+  ch422g_pin_mode(c.exio_int, INPUT);
+  ch422g_commit();
+
+#if BOOT_FAST
+  CO_WAIT_UNTIL(co, gt_probe_5d(), 50, 2);
+  c.ack = !co.timed_out;
+#else
+  CO_SLEEP_MS(co, 20);
+  c.ack = gt_probe_5d();
+#endif
+  Serial.printf("[*] GT911 reset via CH422G: INT=EXIO%u RST=EXIO%u -> %s\n",
+                c.exio_int, c.exio_rst, c.ack ? "0x5D ACK" : "NO ACK");
+  CO_RETURN(co, c.ack);
+  CO_END(co);
+}
+// One attempt held as a single bus job so nothing interleaves with the reset timing
+static bool gt_reset_blocking(uint8_t exio_int, uint8_t exio_rst) {
+  return i2c_bus_call(I2cClient::EXPANDER, I2cPrio::NORMAL, [=]{
+    GtResetCtx c{ exio_int, exio_rst, false };
+    CoSeq co;
+    return co_run_blocking(co, [&](CoSeq& s) { return gt_reset_co(s, c); });
+  });
 }
 static bool try_gt_reset() {
   if (!exio_ok) return false;
-  if (gt_reset_seq(7, 6)) { Serial.println("[*] Mapping A OK (INT=EXIO7, RST=EXIO6)"); return true; }
-  if (gt_reset_seq(6, 7)) { Serial.println("[*] Mapping B OK (INT=EXIO6, RST=EXIO7)"); return true; }
+  auto seq = [](uint8_t exio_int, uint8_t exio_rst) {
+    const bool ok = gt_reset_blocking(exio_int, exio_rst);
+    if (ok) hw_cache_set_exio(exio_int, exio_rst);
+    return ok;
+  };
+  // Warm boot: the mapping that worked last time, alone
+  const HwCache& hc = hw_cache();
+  if (hc.exio_int != 0xFF && seq(hc.exio_int, hc.exio_rst)) {
+    Serial.printf("[*] Cached mapping OK (INT=EXIO%u, RST=EXIO%u)\n", hc.exio_int, hc.exio_rst);
+    return true;
+  }
+  if (!(hc.exio_int == 7 && hc.exio_rst == 6) && seq(7, 6)) { Serial.println("[*] Mapping A OK (INT=EXIO7, RST=EXIO6)"); return true; }
+  if (!(hc.exio_int == 6 && hc.exio_rst == 7) && seq(6, 7)) { Serial.println("[*] Mapping B OK (INT=EXIO6, RST=EXIO7)"); return true; }
   Serial.println("[*] No ACK after A/B reset (will continue anyway)");
+  hw_cache_set_exio(0xFF, 0xFF);
   return false;
 }
 
-/* ------------------------ Simulated data timer -------------------------- */
-static uint32_t cry_high_since = 0;
-static void tick_sim_timer(lv_timer_t*) {
+// Failure-monitor hook (bus task, after a bus recovery): the mapping that
+// brought the GT911 up, nothing else; the touch driver re-inits afterwards
+static bool gt_reset_cached() {
+  const HwCache& hc = hw_cache();
+  if (!exio_ok || hc.exio_int == 0xFF) return false;
+  return gt_reset_blocking(hc.exio_int, hc.exio_rst);
+}
+
+/* Runtime touch reset ('G'): the same sequence stepped from an LVGL timer,
+   so the UI keeps rendering while the controller is held in reset */
+struct TouchResetCtx { CoSeq gt_co; GtResetCtx gt; uint32_t t0; bool busy; };
+static TouchResetCtx s_treset = {};
+
+static CoRc touch_reset_co(CoSeq& co, void* p) {
+  TouchResetCtx& c = *static_cast<TouchResetCtx*>(p);
+  CO_BEGIN(co);
+  lv_indev_enable(touch_indev(), false);      // no samples while the controller is down
+  CO_AWAIT(co, c.gt_co, gt_reset_co(c.gt_co, c.gt));
+  if (co.ok) co.ok = touch_reinit_now();
+  lv_indev_enable(touch_indev(), true);
+  CO_RETURN(co, co.ok);
+  CO_END(co);
+}
+
+static void touch_reset_done(void* p, bool ok) {
+  TouchResetCtx& c = *static_cast<TouchResetCtx*>(p);
+  c.busy = false;
+  Serial.printf("[touch] runtime reset %s after %lu ms\n", ok ? "done" : "FAILED", (unsigned long)(millis() - c.t0));
+}
+
+static void touch_reset_start() {
+  if (s_treset.busy) { Serial.println("[touch] reset already running"); return; }
+  if (!exio_ok || touch_ic() != TouchIC::GT911) { Serial.println("[touch] reset needs the CH422G and a GT911"); return; }
+  // Only the mapping known to bring this GT911 up; guessing could drive the wrong EXIO pins
+  const HwCache& hc = hw_cache();
+  if (hc.exio_int == 0xFF) { Serial.println("[touch] no cached EXIO mapping for the GT911 reset (boot-time reset found none)"); return; }
+  s_treset.gt = GtResetCtx{ hc.exio_int, hc.exio_rst, false };
+  s_treset.t0 = millis();
+  s_treset.busy = co_start_lv(touch_reset_co, &s_treset, touch_reset_done);
+  if (!s_treset.busy) Serial.println("[touch] no free sequence slot");
+}
+
+/* ------------------------------- Serial ------------------------------- */
+/* Keys arrive from the io task through the UI queue; this runs on the ui task */
+static void handle_key(char c) {
+  switch (c) {
+    case 'p': on_play(nullptr); break;
+    case 'x': on_stop(nullptr); break;
+    case '+': g.volume = clamp100(g.volume+5); update_now_playing(); publish_state(); break;
+    case '-': g.volume = clamp100(g.volume-5); update_now_playing(); publish_state(); break;
+    case 'w': g.cryThresh = clamp100(g.cryThresh+2); publish_state(); break;
+    case 's': g.cryThresh = clamp100(g.cryThresh-2); publish_state(); break;
+    case 'g': (void)touch_gt911_config_sync(false); break;   // GT911 config dry-run diff
+    case 't': if (touch_trace_recording()) touch_trace_stop(); else touch_trace_start(); break;
+    case 'y': (void)touch_trace_replay(1); break;
+    case 'Y': (void)touch_trace_replay(4); break;
+    case 'T': touch_trace_dump(Serial); break;
+    case 'l': lat_report(Serial); break;
+    case 'L': lat_reset(); Serial.println("[lat] reset"); break;
+    case 'c': (void)touch_calib_start(3); break;
+    case 'C': (void)touch_calib_start(5); break;
+    case '0': touch_calib_clear(); break;
+    case 'i': touch_print_stats(Serial); break;
+    case 'b': i2c_bus_print_stats(Serial); break;
+    case 'r': i2c_registry_scan(); i2c_scan_show("rescan"); break;   // diagnostics only
+    case 'k': (void)i2c_clock_negotiate(); break;
+    case 'D': i2c_trace_enable(!i2c_trace_enabled()); break;
+    case 'd': i2c_trace_dump(Serial); break;
+    case 'B': boot_report(Serial); break;
+    case 'H': hw_cache_clear(); break;
+    case 'M': app_tasks_print(Serial); break;
+    case 'S': (void)app_model_stress_start(); break;
+    case 'u': cpu_mon_print(Serial); break;
+    case 'U': cpu_panel_toggle(); break;
+    case 'P': pm_print(Serial); break;
+    case 'z': if (screen_asleep()) screen_wake(); else screen_sleep(); break;
+    case 'Z': screen_power_print(Serial); break;
+    case 'R': rtc_state_print(Serial); break;
+    case 'G': touch_reset_start(); break;
+    case '!': Serial.println("[rtc] restarting (warm)"); Serial.flush(); ESP.restart(); break;
+#if I2C_BACKEND_SIM
+    case 'F': i2c_sim_fault_stuck_sda(40); Serial.println("[sim] SDA stuck (40 pulses)"); break;
+#endif
+    default: break;
+  }
+}
+
+/* ------------------------ Simulated telemetry -------------------------- */
+/* Net task poll hook: stands in for the sensor feed until MQTT is wired */
+static Telemetry sim_telemetry() {
   static uint32_t t0 = millis();
   float t = (millis() - t0) / 1000.0f;
   int base = (int)(50 + 35 * sinf(t * 1.7f));
   int noise = (int)(rand() % 11) - 5;
-  g.soundLevel = clamp100(base + noise);
+  return Telemetry{ clamp100(base + noise), false };
+}
+static void sim_telemetry_poll() {
+  UiMsg m{};
+  m.type = UiMsgType::TELEMETRY;
+  m.tel = sim_telemetry();
+  (void)ui_post(m);
+}
+
+/* Net task: outbound state. No broker yet, so just keep the latest consistent snapshot */
+static AppModel s_net_state{};
+static void on_net_msg(const NetMsg&) { s_net_state = app_model_read(); }
+
+/* ui task: telemetry -> model -> widgets */
+static uint32_t cry_high_since = 0;
+static void apply_telemetry(const Telemetry& tel) {
+  g.soundLevel = tel.soundLevel;
+  if (tel.motion) { g.motion = true; g.lastMotionMs = millis(); }
 
   if (g.soundLevel > g.cryThresh) {
     if (!g.cryLikely) {
       if (cry_high_since == 0) cry_high_since = millis();
-      if (millis() - cry_high_since > 600) g.cryLikely = true;
+      if (millis() - cry_high_since > 600) {
+        g.cryLikely = true;
+        if (SCREEN_WAKE_ON_CRY) screen_wake();   // no-op when already lit
+      }
     }
   } else {
     g.cryLikely = false;
@@ -375,21 +557,44 @@ static void tick_sim_timer(lv_timer_t*) {
 
   if (since(g.lastMotionMs) > 10000) g.motion = false;
 
+  model_commit(false);
   update_sound();
   update_motion();
 }
 
+static void on_ui_msg(const UiMsg& m) {
+  switch (m.type) {
+    case UiMsgType::KEY:       handle_key(m.key); break;
+    case UiMsgType::TELEMETRY: apply_telemetry(m.tel); break;
+  }
+}
+
 /* ------------------------ Timers / Lifecycle -------------------------- */
 static void session_timer_cb(lv_timer_t*) { }
 
 /* -------------------------------- setup -------------------------------- */
 void setup() {
+  // Warm reset (watchdog, panic, restart, deep sleep): state from RTC memory, quick boot
+  RtcScreen rtc_screen = RtcScreen::MAIN;
+  const bool warm = rtc_state_restore(g, rtc_screen);
+  if (warm) { g.motion = false; g.lastMotionMs = millis(); }
+  const bool quick = BOOT_FAST || warm;
+  const bool start_dark = warm && rtc_screen == RtcScreen::MAIN_DARK;
+
   Serial.begin(115200);
-  uint32_t t0 = millis();
-  while (!Serial && millis() - t0 < 1500) { }
-  delay(150);
+  if (!quick) {
+    uint32_t t0 = millis();
+    while (!Serial && millis() - t0 < 1500) { }
+    delay(150);
+  }
+  boot_mark("serial");
+  if (const uint32_t run = rtc_state_dropped_run())
+    Serial.printf("[rtc] %lu warm resets in a row: dropping the snapshot, cold boot\n", (unsigned long)run);
+  if (warm) Serial.printf("[rtc] warm reset: restored volume %u, playing %s%s\n", (unsigned)g.volume,
+                          presetName(g.playing), start_dark ? ", screen off" : "");
 
   if (ESP.getPsramSize() < 4*1024*1024) { Serial.println("[fatal] No PSRAM"); for(;;) delay(1000); }
+  (void)hw_cache_load();   // warm boot: verify what worked last time instead of probing everything
 
   // --- I2C bring-up (slow first) ---
   Wire.end();
@@ -402,27 +607,47 @@ void setup() {
   delay(3);
   (void)i2c_bus_recover(); // safe
 
+#if I2C_BACKEND_SIM
+  // Simulated board: CH422G + GT911, INT=EXIO7 / RST=EXIO6 (mapping A)
+  i2c_sim_reset();
+  i2c_sim_add_ch422g();
+  i2c_sim_add_gt911(0x5D);
+  i2c_sim_wire_gt911_reset(7, 6);
+  i2c_sim_set_delay_fn([](uint32_t us) { delayMicroseconds(us); });
+  Serial.println("[i2c] SIMULATED bus (I2C_BACKEND_SIM)");
+#endif
+
+  // From here on Wire/CH422G traffic goes through the bus manager task
+  if (!i2c_bus_start()) Serial.println("[i2c] bus manager start failed (running inline)");
+  boot_mark("i2c");
+
   // --- CH422G (guard) ---
-  exio = new CH422G(I2C_PORT, I2C_SDA, I2C_SCL);
-  if (exio && exio->begin()) {
+  ch422g_pin_mode(EXIO_BL, OUTPUT);
+  ch422g_write(EXIO_BL, LOW);              // BL OFF until first clean frame; others stay INPUT
+  if (ch422g_begin()) {                    // pushes the whole shadow: WR_IO + WR_SET
     exio_ok = true;
-    exio->pinMode(EXIO_BL, OUTPUT);
-    exio->digitalWrite(EXIO_BL, LOW);     // BL OFF until first clean frame
     Serial.println("[exio] EXIO2 -> LOW (BL off)");
-    for (int pin = 0; pin < 8; ++pin) { if (pin != EXIO_BL) exio->pinMode(pin, INPUT); }
     Serial.println("[exio] EXIO[others] -> INPUT (released)");
-    try_gt_reset();
+    if (!quick) { try_gt_reset(); boot_mark("gt-reset"); }
   } else {
     exio_ok = false;
-    Serial.println("[exio] CH422G begin() failed (continuing)");
+    Serial.println("[exio] CH422G not found (continuing)");
   }
-  delay(40);
-
-  Wire.setClock(400000); // faster after bring-up
+  if (!quick) delay(40);
+  boot_mark("exio");
 
   // --- Display + LVGL ---
   boost_rgb_drive();
   if (!gfx->begin()) { Serial.println("[fatal] gfx->begin() failed"); for(;;) delay(1000); }
+  boot_mark("display");
+
+  // Splash from flash straight into the framebuffer; BL on while LVGL/UI/touch come up
+  const bool splash = SPLASH_ENABLE && splash_draw(gfx->getFramebuffer(), 800, 480);
+  if (splash && !start_dark) {
+    delay(SPLASH_SETTLE_MS);
+    backlight_on();
+    boot_mark("first-frame");
+  }
 
   lv_init();
 
@@ -437,55 +662,101 @@ void setup() {
     const int w = area->x2 - area->x1 + 1;
     const int h = area->y2 - area->y1 + 1;
     gfx->draw16bitRGBBitmap(x, y, (uint16_t*)px_map, w, h);
+    screen_note_flush((uint32_t)(w * h));
+    lat_flush(area);
     lv_disp_flush_ready(display);
   });
   lv_display_set_buffers(disp, lv_buf1, lv_buf2, buf_pixels*sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
   lv_display_set_default(disp);
+  lat_attach(disp);
+  screen_power_init(disp, backlight_set, [](bool dark) {
+    rtc_state_save(g, dark ? RtcScreen::MAIN_DARK : RtcScreen::MAIN);
+  });
 
-  const esp_timer_create_args_t tick_args = { .callback=+[](void*){ lv_tick_inc(5); }, .arg=nullptr, .dispatch_method=ESP_TIMER_TASK, .name="lv_tick" };
-  esp_timer_handle_t tick_timer; esp_timer_create(&tick_args, &tick_timer); esp_timer_start_periodic(tick_timer, 5000);
+  // LVGL reads the time on demand: no periodic wakeup, and still correct across light sleep
+  lv_tick_set_cb([]() -> uint32_t { return (uint32_t)(esp_timer_get_time() / 1000); });
+
+  boot_mark("lvgl");
 
   // Build UI
   build_ui();
+  boot_mark("ui");
 
-  // Render a clean frame, then enable BL (only if exio_ok)
-  gfx->fillScreen(BLACK);
+  // Render a clean frame over the splash (or the blank panel), then enable BL if still off
+  if (!splash) gfx->fillScreen(BLACK);
   lv_timer_handler();
   lv_refr_now(NULL);
-  delay(150);
-  if (exio_ok) {
-    exio->digitalWrite(EXIO_BL, HIGH);
-    Serial.println("[exio] EXIO2 -> HIGH (BL on)");
+  if (start_dark) {
+    screen_sleep();                  // it was off before the reset: stay dark
+    boot_mark("ui-frame");
+  } else if (!splash) {
+    delay(quick ? 20 : BOOT_BL_SETTLE_MS);
+    backlight_on();
+    boot_mark("first-frame");
+  } else {
+    boot_mark("ui-frame");
   }
 
-  // Scan & show on-screen
-  i2c_scan_multiline("post-BL");
+  if (warm && rtc_state_soft_reset()) {
+    // Restart / deep sleep: no GT911 reset; cached touch/clock are still verified below
+  } else if (quick) {
+    // Fast boot, or warm after a panic/watchdog (see rtc_state.h): reset, no scan
+    if (exio_ok) { try_gt_reset(); boot_mark("gt-reset"); }
+  } else {
+    // The one full scan of this boot; show on-screen
+    i2c_registry_scan();
+    i2c_scan_show("post-BL");
+    boot_mark("scan");
+  }
 
   // --- Touch auto-detect ---
   touch_init_and_register_lvgl();
+  if (exio_ok) touch_on_hw_reset(gt_reset_cached);
+  boot_mark("touch");
+  const uint32_t cached_hz = hw_cache().clock_hz;
+  if (!(cached_hz && i2c_clock_verify(cached_hz)))
+    (void)i2c_clock_negotiate();   // fastest clock the present devices handle cleanly
+  hw_cache_set_clock(i2c_clock_hz());
+  boot_mark("clock");
   if (touch_present()) {
     char buf[64];
     snprintf(buf, sizeof(buf), "touch: %s @0x%02X", touch_ic_name(), touch_i2c_address());
     Serial.println(buf);
-    if (diagLabel) lv_label_set_text(diagLabel, buf);
+    diag_set(buf);
   } else {
     Serial.println("touch: NOT detected");
-    if (diagLabel) lv_label_set_text(diagLabel, "touch: NOT detected");
+    diag_set("touch: NOT detected");
   }
 
-  // Final sanity: one more scan after touch init
-  i2c_scan_multiline("post-touch");
+  // Final sanity: targeted liveness checks of the known devices only
+  i2c_registry_check_known();
+  i2c_scan_show("post-touch");
 
   // Timers
   lv_timer_create(session_timer_cb, 500, nullptr);
-  lv_timer_create(tick_sim_timer,    120, nullptr);
+  lv_timer_create(cpu_mon_timer, CPU_MON_PERIOD_MS, nullptr);
+  // Up and running for a while: this boot did not crash-loop (warm-boot counter back to 0)
+  lv_timer_set_repeat_count(lv_timer_create([](lv_timer_t*) { rtc_state_boot_ok(); }, RTC_WARM_STABLE_MS, nullptr), 1);
 
   g.lastMotionMs = millis();
+  model_commit(false);
+  (void)hw_cache_save();
+  boot_mark("ready");
+  boot_report(Serial);
+
+  (void)pm_init();   // after boot: bring-up runs at full clock
+
+  // Hand over: ui task owns LVGL from here, io/net feed it through queues
+  if (!app_tasks_start(on_ui_msg, on_net_msg, sim_telemetry_poll))
+    Serial.println("[tasks] start failed; running everything from loop()");
 }
 
 /* -------------------------------- loop --------------------------------- */
 void loop() {
+  if (app_tasks_running()) { vTaskDelete(nullptr); return; }   // Arduino loop task retires
   lv_timer_handler();
-  handleSerial();
+  while (Serial.available()) handle_key((char)Serial.read());
+  static uint32_t last_tel = 0;
+  if (millis() - last_tel >= APP_NET_POLL_MS) { last_tel = millis(); apply_telemetry(sim_telemetry()); }
   delay(2);
 }
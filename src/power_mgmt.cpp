@@ -0,0 +1,114 @@
+// src/power_mgmt.cpp
+#include "power_mgmt.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+#if __has_include(<sdkconfig.h>)
+  #include <sdkconfig.h>
+#endif
+#if defined(CONFIG_PM_ENABLE) && CONFIG_PM_ENABLE
+  #include <esp_pm.h>
+  #if __has_include(<esp32s3/pm.h>)
+    #include <esp32s3/pm.h>
+    typedef esp_pm_config_esp32s3_t PmConfig;   // IDF 4.4
+  #else
+    typedef esp_pm_config_t PmConfig;          // IDF 5
+  #endif
+  #define PM_HAVE_IDF 1
+#else
+  #define PM_HAVE_IDF 0
+#endif
+
+static constexpr int LOCK_COUNT = (int)PmLock::COUNT;
+static const char* const kLockName[LOCK_COUNT] = { "render", "i2c" };
+
+// idf: this holder took the IDF lock (pm_init() can complete while a job holds I2C)
+struct LockStats { int64_t t_acq; uint64_t held_us; uint32_t count; bool idf; };
+
+static volatile bool s_active = false;
+static LockStats s_ls[LOCK_COUNT] = {};
+static portMUX_TYPE s_ls_mux = portMUX_INITIALIZER_UNLOCKED;   // holders and pm_print run on both cores
+static int64_t   s_since_us = 0;
+#if PM_HAVE_IDF
+static esp_pm_lock_handle_t s_h[LOCK_COUNT] = {};
+#endif
+
+bool pm_init() {
+  s_since_us = esp_timer_get_time();
+#if PM_HAVE_IDF
+  for (int i = 0; i < LOCK_COUNT; ++i) {
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, kLockName[i], &s_h[i]) != ESP_OK) {
+      Serial.printf("[pm] lock '%s' create failed\n", kLockName[i]);
+      return false;
+    }
+  }
+  PmConfig cfg = {};
+  cfg.max_freq_mhz = PM_MAX_MHZ;
+  cfg.min_freq_mhz = PM_MIN_MHZ;
+  cfg.light_sleep_enable = PM_LIGHT_SLEEP;
+  const esp_err_t err = esp_pm_configure(&cfg);
+  s_active = (err == ESP_OK);
+  Serial.printf("[pm] DFS %d..%d MHz, light sleep %s -> %s\n", PM_MIN_MHZ, PM_MAX_MHZ,
+                PM_LIGHT_SLEEP ? "on" : "off", s_active ? "OK" : esp_err_to_name(err));
+#else
+  Serial.println(F("[pm] CONFIG_PM_ENABLE off in this core: fixed clock, measuring lock duty only"));
+#endif
+  return s_active;
+}
+
+bool pm_active() { return s_active; }
+
+void pm_lock(PmLock l) {
+  LockStats& ls = s_ls[(int)l];
+  const bool idf = s_active;
+#if PM_HAVE_IDF
+  if (idf) esp_pm_lock_acquire(s_h[(int)l]);
+#endif
+  const int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&s_ls_mux);
+  ls.idf = idf;
+  ls.t_acq = now;
+  ls.count++;
+  portEXIT_CRITICAL(&s_ls_mux);
+}
+
+void pm_unlock(PmLock l) {
+  LockStats& ls = s_ls[(int)l];
+  const int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&s_ls_mux);
+  if (ls.t_acq) { ls.held_us += (uint64_t)(now - ls.t_acq); ls.t_acq = 0; }
+  const bool idf = ls.idf;
+  ls.idf = false;
+  portEXIT_CRITICAL(&s_ls_mux);
+#if PM_HAVE_IDF
+  if (idf) esp_pm_lock_release(s_h[(int)l]);
+#else
+  (void)idf;
+#endif
+}
+
+void pm_print(Stream& out) {
+  LockStats ls_copy[LOCK_COUNT];
+  const int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&s_ls_mux);
+  memcpy(ls_copy, s_ls, sizeof(ls_copy));
+  for (int i = 0; i < LOCK_COUNT; ++i) { s_ls[i].held_us = 0; s_ls[i].count = 0; }
+  portEXIT_CRITICAL(&s_ls_mux);
+  const double wall = (double)(now - s_since_us);
+  out.printf("[pm] %s, window %.1f s\n", s_active ? "DFS active" : "fixed clock (no CONFIG_PM_ENABLE)", wall / 1e6);
+  for (int i = 0; i < LOCK_COUNT; ++i) {
+    const LockStats& ls = ls_copy[i];
+    out.printf("[pm]  %-6s held %6.2f%%  (%lu acquisitions, avg %lu us)\n", kLockName[i],
+               wall > 0 ? ls.held_us * 100.0 / wall : 0.0, (unsigned long)ls.count,
+               ls.count ? (unsigned long)(ls.held_us / ls.count) : 0ul);
+  }
+  // Locks can overlap (different cores), so the sum is an upper bound
+  double sum = 0;
+  for (int i = 0; i < LOCK_COUNT; ++i) sum += ls_copy[i].held_us;
+  out.printf("[pm]  full clock needed <= %.2f%% of the time; the rest can run at %d MHz%s\n",
+             wall > 0 ? sum * 100.0 / wall : 0.0, PM_MIN_MHZ, PM_LIGHT_SLEEP ? " or light-sleep" : "");
+  s_since_us = now;
+#if PM_HAVE_IDF
+  if (s_active) esp_pm_dump_locks(stdout);
+#endif
+}
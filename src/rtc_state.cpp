@@ -0,0 +1,111 @@
+// src/rtc_state.cpp
+#include "rtc_state.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <stddef.h>
+#include <string.h>
+
+// Bump when AppModel / RtcSlot fields change meaning without changing size
+static constexpr uint32_t RTC_LAYOUT_VERSION = 2;
+
+struct RtcSlot {
+  uint32_t  magic;
+  uint32_t  seq;
+  AppModel  model;
+  RtcScreen screen;
+  uint32_t  crc;          // over everything above
+};
+
+// "RT" + layout version + slot size: a firmware with a different AppModel never restores an old snapshot
+static constexpr uint32_t RTC_MAGIC = 0x52540000u | (RTC_LAYOUT_VERSION << 12) | (uint32_t(sizeof(RtcSlot)) & 0xFFFu);
+
+// Consecutive warm boots (crash-loop guard); same magic, so a new layout also starts from 0
+struct RtcBoots { uint32_t magic; uint32_t warm_run; };
+
+RTC_NOINIT_ATTR static RtcSlot  s_slot[2];
+RTC_NOINIT_ATTR static RtcBoots s_boots;
+
+static bool     s_warm = false;
+static uint32_t s_seq = 0;
+static uint32_t s_saves = 0;
+static uint32_t s_dropped_run = 0;       // warm boots in the run the last restore gave up on
+
+// Bitwise CRC-32 (IEEE); the slot is ~30 bytes, no table needed
+static uint32_t crc32(const void* data, size_t n) {
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  uint32_t c = 0xFFFFFFFFu;
+  while (n--) {
+    c ^= *p++;
+    for (int k = 0; k < 8; ++k) c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1u)));
+  }
+  return ~c;
+}
+
+static bool slot_valid(const RtcSlot& s) {
+  return s.magic == RTC_MAGIC && s.crc == crc32(&s, offsetof(RtcSlot, crc));
+}
+
+static bool warm_reason(esp_reset_reason_t r) {
+  switch (r) {
+    case ESP_RST_SW: case ESP_RST_PANIC: case ESP_RST_INT_WDT: case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT: case ESP_RST_DEEPSLEEP:
+      return true;
+    default:
+      return false;     // power-on, brownout, external reset: RTC contents not trusted
+  }
+}
+
+bool rtc_state_restore(AppModel& m, RtcScreen& screen) {
+  s_warm = false;
+  const bool warm = warm_reason(esp_reset_reason());
+  if (!warm || s_boots.magic != RTC_MAGIC) s_boots = { RTC_MAGIC, 0 };
+  const bool looping = warm && ++s_boots.warm_run > RTC_WARM_MAX;
+  s_dropped_run = looping ? s_boots.warm_run : 0;   // reported by setup() once Serial is up
+  if (looping) s_boots.warm_run = 0;
+  const bool v0 = slot_valid(s_slot[0]), v1 = slot_valid(s_slot[1]);
+  if (!warm || looping || (!v0 && !v1)) {
+    memset(s_slot, 0, sizeof(s_slot));
+    s_seq = 0;
+    return false;
+  }
+  const RtcSlot& s = (v0 && (!v1 || (int32_t)(s_slot[0].seq - s_slot[1].seq) > 0)) ? s_slot[0] : s_slot[1];
+  m = s.model;
+  screen = s.screen;
+  s_seq = s.seq;
+  s_warm = true;
+  return true;
+}
+
+void rtc_state_save(const AppModel& m, RtcScreen screen) {
+  // Built off to the side and copied bytewise, so the CRC covers exactly what lands in RTC RAM
+  RtcSlot tmp;
+  memset(&tmp, 0, sizeof(tmp));
+  tmp.magic = RTC_MAGIC;
+  tmp.seq = s_seq + 1;
+  memcpy(&tmp.model, &m, sizeof(m));
+  tmp.screen = screen;
+  tmp.crc = crc32(&tmp, offsetof(RtcSlot, crc));
+  memcpy(&s_slot[tmp.seq & 1], &tmp, sizeof(tmp));   // never the slot holding the newest snapshot
+  s_seq = tmp.seq;
+  s_saves++;
+}
+
+bool rtc_state_warm() { return s_warm; }
+uint32_t rtc_state_dropped_run() { return s_dropped_run; }
+
+bool rtc_state_soft_reset() {
+  const esp_reset_reason_t r = esp_reset_reason();
+  return r == ESP_RST_SW || r == ESP_RST_DEEPSLEEP;
+}
+
+void rtc_state_boot_ok() { s_boots.warm_run = 0; }
+
+void rtc_state_print(Stream& out) {
+  static const char* const kReason[] = { "unknown", "power-on", "external", "software", "panic",
+                                         "int-wdt", "task-wdt", "wdt", "deep-sleep", "brownout", "sdio" };
+  const unsigned r = (unsigned)esp_reset_reason();
+  out.printf("[rtc] reset: %s, %s boot (%lu/%u in a row); snapshot seq %lu, %lu saves this boot, slots %s/%s\n",
+             r < sizeof(kReason) / sizeof(kReason[0]) ? kReason[r] : "?", s_warm ? "warm (restored)" : "cold",
+             (unsigned long)s_boots.warm_run, (unsigned)RTC_WARM_MAX, (unsigned long)s_seq, (unsigned long)s_saves,
+             slot_valid(s_slot[0]) ? "ok" : "-", slot_valid(s_slot[1]) ? "ok" : "-");
+}
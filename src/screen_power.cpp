@@ -0,0 +1,95 @@
+// src/screen_power.cpp
+#include "screen_power.h"
+#include "touch_input.h"
+#include "cpu_monitor.h"
+
+enum ScreenState : uint8_t { LIT=0, DARK, STATES };
+struct StateStats { uint32_t ms, flushes, entries; uint64_t px, busy_us; };
+
+static lv_display_t* s_disp = nullptr;
+static BacklightFn   s_bl = nullptr;
+static ScreenChangeFn s_on_change = nullptr;
+static ScreenState   s_state = LIT;
+static bool          s_bl_pending = false;     // backlight on after the wake refresh
+static StateStats    s_st[STATES] = {};
+static uint32_t      s_since_ms = 0;
+static uint64_t      s_busy_at = 0;
+static uint32_t      s_flushes = 0;
+static uint64_t      s_px = 0;
+
+// Close the running state's accounting
+static void account() {
+  const uint32_t now = millis();
+  const uint64_t busy = cpu_mon_busy_us_total();
+  StateStats& st = s_st[s_state];
+  st.ms += now - s_since_ms;
+  st.busy_us += busy - s_busy_at;
+  st.flushes += s_flushes;
+  st.px += s_px;
+  s_since_ms = now; s_busy_at = busy; s_flushes = 0; s_px = 0;
+}
+
+static void refr_ready_cb(lv_event_t*) {
+  if (!s_bl_pending) return;
+  s_bl_pending = false;
+  if (s_bl) s_bl(true);
+}
+
+static void auto_sleep_timer(lv_timer_t*) {
+  if (SCREEN_SLEEP_AFTER_MS && s_state == LIT && lv_display_get_inactive_time(s_disp) > SCREEN_SLEEP_AFTER_MS)
+    screen_sleep();
+}
+
+void screen_power_init(lv_display_t* disp, BacklightFn backlight, ScreenChangeFn on_change) {
+  s_disp = disp; s_bl = backlight; s_on_change = on_change;
+  s_since_ms = millis(); s_busy_at = cpu_mon_busy_us_total();
+  lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, nullptr);
+  if (SCREEN_SLEEP_AFTER_MS) lv_timer_create(auto_sleep_timer, 1000, nullptr);
+}
+
+void screen_sleep() {
+  if (!s_disp || s_state == DARK) return;
+  account();
+  s_state = DARK; s_st[DARK].entries++;
+  s_bl_pending = false;
+  if (s_bl) s_bl(false);
+  lv_display_enable_invalidation(s_disp, false);
+  lv_timer_pause(lv_display_get_refr_timer(s_disp));
+  touch_set_sleep(true, screen_wake);
+  if (s_on_change) s_on_change(true);
+  Serial.println(F("[screen] off"));
+}
+
+void screen_wake() {
+  if (!s_disp || s_state == LIT) return;
+  account();
+  s_state = LIT; s_st[LIT].entries++;
+  touch_set_sleep(false);
+  lv_display_enable_invalidation(s_disp, true);
+  lv_obj_invalidate(lv_display_get_screen_active(s_disp));   // the one full refresh
+  lv_timer_t* refr = lv_display_get_refr_timer(s_disp);
+  lv_timer_resume(refr);
+  lv_timer_ready(refr);
+  lv_display_trigger_activity(s_disp);
+  s_bl_pending = true;
+  if (s_on_change) s_on_change(false);
+  Serial.println(F("[screen] on"));
+}
+
+bool screen_asleep() { return s_state == DARK; }
+
+void screen_note_flush(uint32_t px) { s_flushes++; s_px += px; }
+
+void screen_power_print(Stream& out) {
+  account();
+  static const char* const kName[STATES] = { "lit", "dark" };
+  out.printf("[screen] now %s\n", kName[s_state]);
+  for (int i = 0; i < STATES; ++i) {
+    const StateStats& st = s_st[i];
+    const float sec = st.ms / 1000.0f;
+    if (sec <= 0) { out.printf("[screen]  %-4s (no time yet)\n", kName[i]); continue; }
+    out.printf("[screen]  %-4s %8.1f s  %6.1f flush/s  %7.1f KB/s framebuffer writes  ui cpu %5.2f%%  (%lu entries)\n",
+               kName[i], sec, st.flushes / sec, st.px * 2 / 1024.0f / sec,
+               st.busy_us / 10.0f / st.ms, (unsigned long)st.entries);
+  }
+}
@@ -0,0 +1,31 @@
+// src/splash.cpp
+#include "splash.h"
+#include "splash_image.h"
+#include <stddef.h>
+
+#if __has_include(<esp32s3/rom/cache.h>)
+  #include <esp32s3/rom/cache.h>
+  #define SPLASH_CACHE_WB 1
+#else
+  #define SPLASH_CACHE_WB 0
+#endif
+
+bool splash_draw(uint16_t* fb, uint16_t w, uint16_t h) {
+  if (!fb || w != SPLASH_W || h != SPLASH_H) return false;
+
+  uint16_t* p = fb;
+  uint16_t* const end = fb + (size_t)w * h;
+  for (uint32_t i = 0; i < SPLASH_RUNS; ++i) {
+    uint32_t run = kSplashRle[2 * i];
+    const uint16_t color = kSplashRle[2 * i + 1];
+    if (run > (uint32_t)(end - p)) run = (uint32_t)(end - p);   // never past the framebuffer
+    while (run--) *p++ = color;
+  }
+  while (p < end) *p++ = 0;          // short image: black the rest
+
+#if SPLASH_CACHE_WB
+  // The LCD DMA reads PSRAM directly; push the dirty lines out of the cache
+  Cache_WriteBack_Addr((uint32_t)(uintptr_t)fb, (uint32_t)((size_t)w * h * sizeof(uint16_t)));
+#endif
+  return true;
+}
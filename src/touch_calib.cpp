@@ -0,0 +1,178 @@
+// src/touch_calib.cpp
+#include "touch_calib.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <lvgl.h>
+#include <math.h>
+
+static constexpr const char* NVS_NS  = "touch";
+static constexpr const char* NVS_KEY = "affine";
+static constexpr uint32_t CAL_MAGIC  = 0x54434131;   // "TCA1"
+
+struct StoredCal { uint32_t magic; TouchAffine m; };
+
+// Target layout in screen pixels; the first 3 form a wide triangle for 3-point mode
+static constexpr int CAL_MAX_PTS = 5;
+static constexpr int CAL_MARGIN  = 60;
+static const lv_point_t kTargets[CAL_MAX_PTS] = {
+  { CAL_MARGIN,                  CAL_MARGIN },
+  { TOUCH_SCREEN_W - CAL_MARGIN, TOUCH_SCREEN_H / 2 },
+  { TOUCH_SCREEN_W / 2,          TOUCH_SCREEN_H - CAL_MARGIN },
+  { TOUCH_SCREEN_W - CAL_MARGIN, CAL_MARGIN },
+  { CAL_MARGIN,                  TOUCH_SCREEN_H - CAL_MARGIN },
+};
+
+static lv_obj_t* s_scr = nullptr;
+static lv_obj_t* s_prev_scr = nullptr;
+static lv_obj_t* s_cross = nullptr;
+static lv_obj_t* s_hint = nullptr;
+static uint8_t   s_npts = 0, s_idx = 0;
+static int32_t   s_acc_x = 0, s_acc_y = 0, s_acc_n = 0;
+static double    s_raw[CAL_MAX_PTS][2];
+
+// -------- NVS --------
+bool touch_calib_load() {
+  Preferences p;
+  if (!p.begin(NVS_NS, true)) return false;
+  StoredCal sc{};
+  const bool ok = p.getBytes(NVS_KEY, &sc, sizeof(sc)) == sizeof(sc) && sc.magic == CAL_MAGIC;
+  p.end();
+  if (ok) touch_set_affine(sc.m);
+  return ok;
+}
+
+bool touch_calib_save(const TouchAffine& m) {
+  Preferences p;
+  if (!p.begin(NVS_NS, false)) return false;
+  StoredCal sc{ CAL_MAGIC, m };
+  const bool ok = p.putBytes(NVS_KEY, &sc, sizeof(sc)) == sizeof(sc);
+  p.end();
+  return ok;
+}
+
+void touch_calib_clear() {
+  Preferences p;
+  if (p.begin(NVS_NS, false)) { p.remove(NVS_KEY); p.end(); }
+  touch_set_affine(touch_default_affine());
+  Serial.println(F("[calib] cleared; using compile-time orientation/offsets"));
+}
+
+// -------- Fit --------
+/* Least squares for out = k0*rx + k1*ry + k2 via 3x3 normal equations (Cramer) */
+static bool fit_axis(uint8_t n, const double raw[][2], const double* out, double k[3]) {
+  double sxx=0, sxy=0, sx=0, syy=0, sy=0, so=0, sxo=0, syo=0;
+  for (uint8_t i=0; i<n; ++i) {
+    const double x = raw[i][0], y = raw[i][1], o = out[i];
+    sxx += x*x; sxy += x*y; sx += x; syy += y*y; sy += y;
+    sxo += x*o; syo += y*o; so += o;
+  }
+  const double M[3][3] = { { sxx, sxy, sx }, { sxy, syy, sy }, { sx, sy, (double)n } };
+  const double r[3] = { sxo, syo, so };
+  auto det3 = [](const double A[3][3]) {
+    return A[0][0]*(A[1][1]*A[2][2]-A[1][2]*A[2][1])
+         - A[0][1]*(A[1][0]*A[2][2]-A[1][2]*A[2][0])
+         + A[0][2]*(A[1][0]*A[2][1]-A[1][1]*A[2][0]);
+  };
+  const double d = det3(M);
+  if (fabs(d) < 1e-6) return false;   // collinear / duplicate taps
+  for (int c=0; c<3; ++c) {
+    double T[3][3];
+    for (int i=0;i<3;++i) for (int j=0;j<3;++j) T[i][j] = (j==c) ? r[i] : M[i][j];
+    k[c] = det3(T) / d;
+  }
+  return true;
+}
+
+static int32_t q16(double v) { return (int32_t)lround(v * 65536.0); }
+
+static bool solve(TouchAffine& m, double& worst_px) {
+  double ox[CAL_MAX_PTS], oy[CAL_MAX_PTS], kx[3], ky[3];
+  for (uint8_t i=0; i<s_npts; ++i) { ox[i] = kTargets[i].x; oy[i] = kTargets[i].y; }
+  if (!fit_axis(s_npts, s_raw, ox, kx) || !fit_axis(s_npts, s_raw, oy, ky)) return false;
+
+  worst_px = 0;
+  for (uint8_t i=0; i<s_npts; ++i) {
+    const double ex = kx[0]*s_raw[i][0] + kx[1]*s_raw[i][1] + kx[2] - ox[i];
+    const double ey = ky[0]*s_raw[i][0] + ky[1]*s_raw[i][1] + ky[2] - oy[i];
+    worst_px = fmax(worst_px, sqrt(ex*ex + ey*ey));
+  }
+  m.a = q16(kx[0]); m.b = q16(kx[1]); m.c = q16(kx[2] + 0.5);
+  m.d = q16(ky[0]); m.e = q16(ky[1]); m.f = q16(ky[2] + 0.5);
+  return true;
+}
+
+// -------- Screen --------
+static void show_target() {
+  lv_obj_set_pos(s_cross, kTargets[s_idx].x - 15, kTargets[s_idx].y - 15);
+  char buf[64];
+  snprintf(buf, sizeof(buf), "Touch the target (%u/%u)", (unsigned)(s_idx+1), (unsigned)s_npts);
+  lv_label_set_text(s_hint, buf);
+}
+
+static void finish() {
+  lv_screen_load(s_prev_scr);
+  lv_obj_delete_async(s_scr);
+  s_scr = nullptr;
+}
+
+static void calib_event_cb(lv_event_t* e) {
+  const lv_event_code_t code = lv_event_get_code(e);
+  int16_t rx, ry;
+  if (code == LV_EVENT_PRESSING) {
+    if (touch_last_raw(rx, ry)) { s_acc_x += rx; s_acc_y += ry; s_acc_n++; }
+    return;
+  }
+  if (code != LV_EVENT_RELEASED || s_acc_n == 0) return;
+
+  s_raw[s_idx][0] = double(s_acc_x) / s_acc_n;
+  s_raw[s_idx][1] = double(s_acc_y) / s_acc_n;
+  Serial.printf("[calib] point %u: target (%d,%d) raw (%.1f,%.1f)\n", (unsigned)s_idx,
+                (int)kTargets[s_idx].x, (int)kTargets[s_idx].y, s_raw[s_idx][0], s_raw[s_idx][1]);
+  s_acc_x = s_acc_y = s_acc_n = 0;
+  if (++s_idx < s_npts) { show_target(); return; }
+
+  TouchAffine m{};
+  double worst = 0;
+  if (!solve(m, worst) || (s_npts > 3 && worst > TOUCH_CALIB_MAX_RESIDUAL_PX)) {
+    Serial.printf("[calib] fit rejected (residual %.1f px); try again\n", worst);
+    s_idx = 0; show_target();
+    return;
+  }
+  touch_set_affine(m);
+  const bool saved = touch_calib_save(m);
+  Serial.printf("[calib] a=%ld b=%ld c=%ld d=%ld e=%ld f=%ld (Q16) residual=%.1f px  %s\n",
+                (long)m.a, (long)m.b, (long)m.c, (long)m.d, (long)m.e, (long)m.f, worst,
+                saved ? "saved to NVS" : "NVS save FAILED");
+  finish();
+}
+
+bool touch_calib_start(uint8_t points) {
+  if (s_scr || !touch_present()) return false;
+  s_npts = (points >= 5) ? 5 : 3;
+  s_idx = 0; s_acc_x = s_acc_y = s_acc_n = 0;
+
+  s_prev_scr = lv_screen_active();
+  s_scr = lv_obj_create(nullptr);
+  lv_obj_set_style_bg_color(s_scr, lv_color_hex(0x000000), 0);
+  lv_obj_clear_flag(s_scr, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(s_scr, calib_event_cb, LV_EVENT_PRESSING, nullptr);
+  lv_obj_add_event_cb(s_scr, calib_event_cb, LV_EVENT_RELEASED, nullptr);
+
+  s_cross = lv_obj_create(s_scr);
+  lv_obj_set_size(s_cross, 30, 30);
+  lv_obj_set_style_radius(s_cross, LV_RADIUS_CIRCLE, 0);
+  lv_obj_set_style_bg_color(s_cross, lv_color_hex(0xFFFF00), 0);
+  lv_obj_set_style_border_width(s_cross, 0, 0);
+  lv_obj_clear_flag(s_cross, LV_OBJ_FLAG_CLICKABLE);   // presses go to the screen
+
+  s_hint = lv_label_create(s_scr);
+  lv_obj_set_style_text_color(s_hint, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_align(s_hint, LV_ALIGN_CENTER, 0, 0);
+
+  show_target();
+  lv_screen_load(s_scr);
+  Serial.printf("[calib] %u-point calibration started\n", (unsigned)s_npts);
+  return true;
+}
+
+bool touch_calib_active() { return s_scr != nullptr; }
@@ -1,29 +1,24 @@
 // src/touch_input.cpp
 #include "touch_input.h"
+#include "touch_drivers.h"
+#include "touch_trace.h"
+#include "latency_trace.h"
+#include "touch_calib.h"
+#include "i2c_registry.h"
+#include "i2c_clock.h"
+#include "i2c_health.h"
+#include "hw_cache.h"
+#include "app_tasks.h"
 #include <Arduino.h>
 #include <Wire.h>
 #include <lvgl.h>
-#include <Adafruit_FT6206.h>   // FT6x36 family
-
-// --- Optional GT911 library; compile even if it's missing ---
-#if __has_include(<GT911.h>)
-  #include <GT911.h>
-  #define HAVE_GT911_LIB 1
-#else
-  #define HAVE_GT911_LIB 0
-#endif
+#include <algorithm>
 
 // ---------------- Internals ----------------
-enum class TouchIC : uint8_t { NONE=0, FT6X36, GT911 };
 static TouchIC s_ic = TouchIC::NONE;
+static const char* s_ic_name = "NONE";
 static uint8_t s_addr = 0x00;
-
-static Adafruit_FT6206 s_ft;
-
-#if HAVE_GT911_LIB
-  static GT911 s_gt;
-#endif
-static bool s_gt_using_lib = false;
+static lv_indev_read_cb_t s_read_cb = nullptr;   // touch_read_cb<Driver> picked at detect
 static lv_indev_t* s_indev = nullptr;
 
 // --- Screen geometry (from your -D’s or defaults) ---
@@ -37,292 +32,452 @@ static lv_indev_t* s_indev = nullptr;
 // --- Calibration offsets (from touch_input.h) ---
 // Positive X → shift touch RIGHT; Positive Y → shift touch DOWN
 
-// GT911 minimal raw map
-static constexpr uint16_t GT_REG_PRODUCT_ID = 0x8140; // 4 bytes ASCII
-static constexpr uint16_t GT_REG_STATUS     = 0x814E; // [7]=buf ready, [3:0]=points
-static constexpr uint16_t GT_REG_POINTS     = 0x8150; // first point block
-
-struct GTPointRaw {
-  uint16_t x;
-  uint16_t y;
-  uint16_t size;
-  uint8_t  id;
-  uint8_t  reserved;
-} __attribute__((packed));
-
-/* Apply orientation AND calibration offsets, then clamp */
-static inline void orient_map(int16_t& x, int16_t& y) {
-#if TOUCH_SWAP_XY
-  int16_t t=x; x=y; y=t;
-#endif
-#if TOUCH_INVERT_X
-  x = TOUCH_SCREEN_W - 1 - x;
-#endif
-#if TOUCH_INVERT_Y
-  y = TOUCH_SCREEN_H - 1 - y;
-#endif
+// GT911 config block: 184 bytes at 0x8047..0x80FE, then checksum + "fresh" flag
+static constexpr uint16_t GT_REG_CONFIG     = 0x8047;
+static constexpr uint16_t GT_REG_CFG_CHKSUM = 0x80FF; // two's complement of byte sum
+static constexpr uint16_t GT_REG_CFG_FRESH  = 0x8100; // write 1 -> controller applies + saves
+static constexpr size_t   GT_CONFIG_LEN     = 184;
+
+// Offsets inside the config block (datasheet names)
+enum : uint8_t {
+  GT_CFG_VERSION      = 0,   // 'A'..'Z'; controller only accepts >= stored version
+  GT_CFG_X_MAX        = 1,   // u16 LE
+  GT_CFG_Y_MAX        = 3,   // u16 LE
+  GT_CFG_TOUCH_NUMBER = 5,   // [3:0] 1..5
+  GT_CFG_TOUCH_LEVEL  = 12,  // Screen_Touch_Level
+  GT_CFG_LEAVE_LEVEL  = 13,  // Screen_Leave_Level
+  GT_CFG_REFRESH_RATE = 15,  // [3:0] report interval = 5 + N ms
+};
+
+/* Affine map (orientation + calibration) in Q16; see touch_default_affine() */
+static TouchAffine s_cal = touch_default_affine();
+static int16_t s_raw_x = 0, s_raw_y = 0;
+static bool s_raw_valid = false;
+
+/* Per-sample path: integer MACs + MIN/MAX clamp, no float and no data-dependent branches */
+static inline void cal_map(int16_t& x, int16_t& y) {
+  s_raw_x = x; s_raw_y = y; s_raw_valid = true;
+  const int32_t sx = int32_t(((int64_t)s_cal.a * x + (int64_t)s_cal.b * y + s_cal.c) >> 16);
+  const int32_t sy = int32_t(((int64_t)s_cal.d * x + (int64_t)s_cal.e * y + s_cal.f) >> 16);
+  x = (int16_t)std::min<int32_t>(std::max<int32_t>(sx, 0), TOUCH_SCREEN_W - 1);
+  y = (int16_t)std::min<int32_t>(std::max<int32_t>(sy, 0), TOUCH_SCREEN_H - 1);
+}
 
-  // ---- Calibration offsets (NEW) ----
-  x += TOUCH_X_OFFSET;
-  y += TOUCH_Y_OFFSET;
+// -------- Reset/INT helpful sequence (if wired) --------
+static CoRc touch_hw_reset_co(CoSeq& co) {
+  CO_BEGIN(co);
+  if (TOUCH_RST_PIN >= 0) {
+    pinMode(TOUCH_RST_PIN, OUTPUT);
+    digitalWrite(TOUCH_RST_PIN, HIGH);
+  }
+  if (TOUCH_INT_PIN >= 0) {
+    pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
+  }
+  if (TOUCH_RST_PIN < 0) CO_RETURN(co, true);
 
-  // Clamp to screen bounds
-  if (x < 0) x = 0; if (y < 0) y = 0;
-  if (x >= TOUCH_SCREEN_W) x = TOUCH_SCREEN_W - 1;
-  if (y >= TOUCH_SCREEN_H) y = TOUCH_SCREEN_H - 1;
+  // Simple GT911-friendly reset pulse; harmless for FT6x36
+  if (TOUCH_INT_PIN >= 0) { pinMode(TOUCH_INT_PIN, OUTPUT); digitalWrite(TOUCH_INT_PIN, LOW); }
+  digitalWrite(TOUCH_RST_PIN, LOW);
+  CO_SLEEP_MS(co, 10);
+  digitalWrite(TOUCH_RST_PIN, HIGH);
+  CO_SLEEP_MS(co, 10);
+  if (TOUCH_INT_PIN >= 0) pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
+  CO_END(co);
 }
 
-// -------- I2C helpers --------
-static bool i2c_probe(uint8_t addr) {
-  Wire.beginTransmission(addr);
-  return (Wire.endTransmission() == 0);
-}
-static bool i2c_write_u8(uint8_t addr, uint16_t reg, uint8_t v) {
-  uint8_t pkt[3] = { uint8_t(reg>>8), uint8_t(reg&0xFF), v };
-  Wire.beginTransmission(addr);
-  Wire.write(pkt, 3);
-  return (Wire.endTransmission() == 0);
+// -------- Detection --------
+template <class D>
+static void touch_read_cb(lv_indev_t*, lv_indev_data_t* data);
+
+// After an external controller reset: controller answers again and is brought back up
+template <class D>
+static bool touch_restart() { return i2c_probe(s_addr) && D::begin(s_addr); }
+static I2cReinitFn s_restart = nullptr;
+
+// Failure-monitor hook after a bus recovery: a GT911 that wedged with the bus
+// gets a hardware reset first (board sequence, see touch_on_hw_reset)
+static TouchHwResetFn s_hw_reset = nullptr;
+template <class D>
+static bool touch_reinit() {
+  if (D::IC == TouchIC::GT911 && s_hw_reset) (void)s_hw_reset();
+  return touch_restart<D>();
 }
-static bool i2c_read(uint8_t addr, const uint8_t* reg, size_t reg_len, uint8_t* buf, size_t len) {
-  Wire.beginTransmission(addr);
-  Wire.write(reg, reg_len);
-  if (Wire.endTransmission(false) != 0) return false;
-  if (Wire.requestFrom((int)addr, (int)len) != (int)len) return false;
-  for (size_t i=0;i<len;i++) buf[i] = Wire.read();
+
+template <class D>
+static bool try_driver() {
+  uint8_t addr = 0;
+  if (!D::probe(addr)) return false;
+  s_ic = D::IC; s_ic_name = D::NAME; s_addr = addr;
+  Serial.printf("[touch] %s detected @ 0x%02X\n", D::NAME, addr);
+#if TOUCH_GT_CFG_MODE
+  if (D::IC == TouchIC::GT911) (void)touch_gt911_config_sync(TOUCH_GT_CFG_MODE >= 2);
+#endif
+  if (!D::begin(addr)) {
+    Serial.printf("[touch] %s begin() failed\n", D::NAME);
+    s_ic = TouchIC::NONE; s_ic_name = "NONE"; s_addr = 0x00;
+    return false;
+  }
+  s_read_cb = touch_read_cb<D>;
+  s_restart = touch_restart<D>;
+  i2c_health_on_recover(touch_reinit<D>);
+  hw_cache_set_touch(D::IC, addr);
+  Serial.printf("[touch] %s ready\n", D::NAME);
   return true;
 }
 
-// -------- Bus recovery (if SDA stuck low) --------
-bool i2c_bus_recover(uint8_t sclPin, uint8_t sdaPin) {
-  Wire.end();
-  pinMode(sclPin, INPUT_PULLUP);
-  pinMode(sdaPin, INPUT_PULLUP);
-  delay(1);
-
-  if (digitalRead(sdaPin) == HIGH) {
-    Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
-    Wire.setClock(100000);
-    return true;
+#if TOUCH_DRIVER != TOUCH_DRV_SIM
+// Warm boot: only the driver found last time (its own targeted probe)
+static bool try_cached() {
+  const HwCache& hc = hw_cache();
+  bool ok = false;
+  switch (hc.touch_ic) {
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_GT911
+    case TouchIC::GT911:  ok = try_driver<Gt911Driver>(); break;
+#endif
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_FT6X36
+    case TouchIC::FT6X36: ok = try_driver<Ft6x36Driver>(); break;
+#endif
+#if TOUCH_DRIVER == TOUCH_DRV_AUTO || TOUCH_DRIVER == TOUCH_DRV_CST816
+    case TouchIC::CST816: ok = try_driver<Cst816Driver>(); break;
+#endif
+    default: return false;
   }
+  Serial.printf("[touch] cached controller @0x%02X %s\n", hc.touch_addr, ok ? "verified" : "gone; full discovery");
+  return ok;
+}
+#endif
 
-  // SDA low: clock SCL to free it
-  pinMode(sclPin, OUTPUT);
-  for (int i=0; i<16 && (digitalRead(sdaPin)==LOW); ++i) {
-    digitalWrite(sclPin, HIGH); delayMicroseconds(5);
-    digitalWrite(sclPin, LOW ); delayMicroseconds(5);
-  }
+static void detect_ic() {
+#if TOUCH_DRIVER == TOUCH_DRV_SIM
+  if (try_driver<SimTouchDriver>()) return;
+#else
+  CoSeq co;
+  (void)co_run_blocking(co, touch_hw_reset_co);   // before detection: nothing else to run yet
+  if (try_cached()) return;
+  #if TOUCH_DRIVER == TOUCH_DRV_AUTO
+  if (try_driver<Ft6x36Driver>() || try_driver<Gt911Driver>() || try_driver<Cst816Driver>()) return;
+  #elif TOUCH_DRIVER == TOUCH_DRV_GT911
+  if (try_driver<Gt911Driver>()) return;
+  #elif TOUCH_DRIVER == TOUCH_DRV_FT6X36
+  if (try_driver<Ft6x36Driver>()) return;
+  #elif TOUCH_DRIVER == TOUCH_DRV_CST816
+  if (try_driver<Cst816Driver>()) return;
+  #endif
+#endif
+  s_ic = TouchIC::NONE; s_addr = 0x00;
+  hw_cache_set_touch(TouchIC::NONE, 0x00);
+  Serial.println(F("[touch] No touch IC found (FT 0x38 / GT 0x5D,0x14 / CST 0x15)"));
+}
+
+// -------- GT911 config programming --------
+static uint8_t gt_checksum(const uint8_t* cfg) {
+  uint8_t sum = 0;
+  for (size_t i=0; i<GT_CONFIG_LEN; ++i) sum += cfg[i];
+  return uint8_t(~sum + 1);
+}
+static inline uint16_t gt_u16(const uint8_t* p) { return (uint16_t)p[0] | ((uint16_t)p[1] << 8); }
+static inline void gt_put_u16(uint8_t* p, uint16_t v) { p[0] = uint8_t(v & 0xFF); p[1] = uint8_t(v >> 8); }
+
+/* Apply TOUCH_GT_* onto a copy of the current config; everything else stays vendor-tuned */
+static void gt_config_desired(const uint8_t* cur, uint8_t* want) {
+  memcpy(want, cur, GT_CONFIG_LEN);
+
+  // Output the panel's native resolution so the read path maps 1:1 (no host scaling).
+  // With TOUCH_SWAP_XY the controller X axis runs along the screen height.
+#if TOUCH_SWAP_XY
+  gt_put_u16(&want[GT_CFG_X_MAX], TOUCH_SCREEN_H);
+  gt_put_u16(&want[GT_CFG_Y_MAX], TOUCH_SCREEN_W);
+#else
+  gt_put_u16(&want[GT_CFG_X_MAX], TOUCH_SCREEN_W);
+  gt_put_u16(&want[GT_CFG_Y_MAX], TOUCH_SCREEN_H);
+#endif
+
+  const uint8_t pts = uint8_t(std::min(std::max(TOUCH_GT_TOUCH_POINTS, 1), 5));
+  want[GT_CFG_TOUCH_NUMBER] = uint8_t((cur[GT_CFG_TOUCH_NUMBER] & 0xF0) | pts);
 
-  // STOP condition
-  pinMode(sdaPin, OUTPUT);
-  digitalWrite(sdaPin, LOW);  delayMicroseconds(5);
-  digitalWrite(sclPin, HIGH); delayMicroseconds(5);
-  digitalWrite(sdaPin, HIGH); delayMicroseconds(5);
+  const int rate_ms = std::min(std::max(int(TOUCH_GT_REPORT_MS), 5), 20);
+  want[GT_CFG_REFRESH_RATE] = uint8_t((cur[GT_CFG_REFRESH_RATE] & 0xF0) | (rate_ms - 5));
 
-  Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
-  Wire.setClock(100000);
-  delay(3);
-  return (digitalRead(sdaPin) == HIGH);
+  if (TOUCH_GT_TOUCH_LEVEL) want[GT_CFG_TOUCH_LEVEL] = TOUCH_GT_TOUCH_LEVEL;
+  if (TOUCH_GT_LEAVE_LEVEL) want[GT_CFG_LEAVE_LEVEL] = TOUCH_GT_LEAVE_LEVEL;
+
+  // Keep the stored version: GT911 accepts a config whose version is >= the stored one,
+  // and bumping it would lock out the vendor's own updates later.
 }
 
-void i2c_full_scan_print(Stream& out) {
-  out.print(F("I2C scan:"));
-  bool any = false;
-  for (uint8_t a=1; a<127; ++a) {
-    Wire.beginTransmission(a);
-    if (Wire.endTransmission() == 0) { out.printf(" 0x%02X", a); any = true; }
-  }
-  if (!any) out.print(F(" (none)"));
-  out.println();
+static size_t gt_config_diff(const uint8_t* cur, const uint8_t* want, Stream& out) {
+  size_t n = 0;
+  auto field = [&](const char* name, unsigned a, unsigned b) {
+    if (a == b) return;
+    out.printf("[touch][GT][cfg] %-12s %u -> %u\n", name, a, b);
+    ++n;
+  };
+  field("x_max",        gt_u16(&cur[GT_CFG_X_MAX]),  gt_u16(&want[GT_CFG_X_MAX]));
+  field("y_max",        gt_u16(&cur[GT_CFG_Y_MAX]),  gt_u16(&want[GT_CFG_Y_MAX]));
+  field("touch_points", cur[GT_CFG_TOUCH_NUMBER] & 0x0F, want[GT_CFG_TOUCH_NUMBER] & 0x0F);
+  field("report_ms",    5 + (cur[GT_CFG_REFRESH_RATE] & 0x0F), 5 + (want[GT_CFG_REFRESH_RATE] & 0x0F));
+  field("touch_level",  cur[GT_CFG_TOUCH_LEVEL],     want[GT_CFG_TOUCH_LEVEL]);
+  field("leave_level",  cur[GT_CFG_LEAVE_LEVEL],     want[GT_CFG_LEAVE_LEVEL]);
+  return n;
 }
 
-// -------- Reset/INT helpful sequence (if wired) --------
-static void touch_hw_reset_sequence() {
-  if (TOUCH_RST_PIN >= 0) {
-    pinMode(TOUCH_RST_PIN, OUTPUT);
-    digitalWrite(TOUCH_RST_PIN, HIGH);
+bool touch_gt911_config_sync(bool write, Stream& out) {
+  if (s_ic != TouchIC::GT911) { out.println(F("[touch][GT][cfg] no GT911 present")); return false; }
+
+  uint8_t cur[GT_CONFIG_LEN + 1];   // + checksum byte
+  if (!i2c_read_block(s_addr, GT_REG_CONFIG, cur, sizeof(cur))) {
+    out.println(F("[touch][GT][cfg] read failed"));
+    return false;
   }
-  if (TOUCH_INT_PIN >= 0) {
-    pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
+  const uint8_t chk = gt_checksum(cur);
+  if (chk != cur[GT_CONFIG_LEN]) {
+    // A torn read would otherwise be written straight back into the controller's flash
+    out.printf("[touch][GT][cfg] checksum mismatch (read 0x%02X, calc 0x%02X) - not touching it\n",
+               cur[GT_CONFIG_LEN], chk);
+    return false;
   }
 
-  // Simple GT911-friendly reset pulse; harmless for FT6x36
-  if (TOUCH_RST_PIN >= 0) {
-    if (TOUCH_INT_PIN >= 0) { pinMode(TOUCH_INT_PIN, OUTPUT); digitalWrite(TOUCH_INT_PIN, LOW); }
-    digitalWrite(TOUCH_RST_PIN, LOW);  delay(10);
-    digitalWrite(TOUCH_RST_PIN, HIGH); delay(10);
-    if (TOUCH_INT_PIN >= 0) pinMode(TOUCH_INT_PIN, INPUT_PULLUP);
+  uint8_t want[GT_CONFIG_LEN];
+  gt_config_desired(cur, want);
+  out.printf("[touch][GT][cfg] version='%c' (0x%02X)%s\n", cur[GT_CFG_VERSION], cur[GT_CFG_VERSION],
+             write ? "" : "  [dry-run]");
+  if (gt_config_diff(cur, want, out) == 0) {
+    out.println(F("[touch][GT][cfg] up to date"));
+    return true;
+  }
+  if (!write) return false;
+
+  // Only write on change: Config_Fresh commits to the controller's flash
+  uint8_t tail[2] = { gt_checksum(want), 0x01 };  // 0x80FF checksum, 0x8100 fresh
+  if (!i2c_write_block(s_addr, GT_REG_CONFIG, want, GT_CONFIG_LEN) ||
+      !i2c_write_block(s_addr, GT_REG_CFG_CHKSUM, tail, sizeof(tail))) {
+    out.println(F("[touch][GT][cfg] write failed"));
+    return false;
   }
+  delay(100);  // controller reloads config (and saves to flash) after the fresh flag
+
+  uint8_t back[GT_CONFIG_LEN];
+  bool ok = i2c_read_block(s_addr, GT_REG_CONFIG, back, sizeof(back)) &&
+            memcmp(back, want, GT_CONFIG_LEN) == 0;
+  out.printf("[touch][GT][cfg] write %s\n", ok ? "verified" : "NOT verified (version rejected?)");
+  return ok;
 }
 
-// -------- Detection --------
-static void detect_ic() {
-  touch_hw_reset_sequence();
-
-  bool has_ft   = i2c_probe(0x38);
-  bool has_gt5d = i2c_probe(0x5D);
-  bool has_gt14 = i2c_probe(0x14);
-
-  Serial.printf("[touch][probe] 0x38=%d 0x5D=%d 0x14=%d\n", has_ft, has_gt5d, has_gt14);
-
-  if (has_ft) {
-    // Extra sanity: some boards pull 0x38 but aren’t FT; quick ID read (best-effort)
-    uint8_t chip = 0, vend = 0;
-    uint8_t regc[1] = { 0xA8 }; // CHIPID
-    uint8_t regv[1] = { 0xA3 }; // VENDID
-    if (i2c_read(0x38, regc, 1, &chip, 1) && i2c_read(0x38, regv, 1, &vend, 1)) {
-      Serial.printf("[touch][FT] CHIPID=0x%02X VENDID=0x%02X\n", chip, vend);
-      if (chip == 0x06 || chip == 0x36) {
-        s_ic = TouchIC::FT6X36; s_addr = 0x38;
-        Serial.println(F("[touch] FT6x36 detected @ 0x38"));
-        return;
-      }
-    }
-    Serial.println(F("[touch][FT] 0x38 ACKed but IDs not FT → ignoring"));
-  }
+// -------- Adaptive polling --------
+enum PollMode : uint8_t { POLL_ACTIVE=0, POLL_IDLE, POLL_MODES };
+struct PollStats { uint32_t reads, busy_us, wall_ms; };
+
+static PollMode  s_poll = POLL_ACTIVE;
+static uint32_t  s_poll_since_ms = 0;
+static uint32_t  s_last_contact_ms = 0;
+static PollStats s_ps[POLL_MODES] = {};
+static volatile bool s_int_pending = false;
+
+static void IRAM_ATTR touch_int_isr() { s_int_pending = true; ui_wake_from_isr(); }
+
+static void set_poll_mode(PollMode m) {
+  const uint32_t now = millis();
+  s_ps[s_poll].wall_ms += now - s_poll_since_ms;
+  s_poll_since_ms = now;
+  s_poll = m;
+  if (s_indev) lv_timer_set_period(lv_indev_get_read_timer(s_indev),
+                                   m == POLL_ACTIVE ? TOUCH_POLL_ACTIVE_MS : TOUCH_POLL_IDLE_MS);
+}
 
-  if (has_gt5d || has_gt14) {
-    s_ic = TouchIC::GT911; s_addr = has_gt5d ? 0x5D : 0x14;
-    Serial.printf("[touch] GT911 selected @ 0x%02X\n", s_addr);
+static void (*s_wake_fn)() = nullptr;   // set while the screen is off
+static bool  s_swallow = false;          // press that woke the screen: hide it from LVGL
 
-    // Product ID read
-    uint8_t idbuf[4] = {0};
-    uint8_t reg[2] = { uint8_t(GT_REG_PRODUCT_ID>>8), uint8_t(GT_REG_PRODUCT_ID & 0xFF) };
-    if (i2c_read(s_addr, reg, 2, idbuf, 4)) {
-      Serial.printf("[touch][GT] Product ID: %c%c%c%c\n", idbuf[0], idbuf[1], idbuf[2], idbuf[3]);
-    }
+void touch_set_sleep(bool sleep, void (*on_wake)()) {
+  s_wake_fn = sleep ? on_wake : nullptr;
+  if (sleep && s_poll != POLL_IDLE) set_poll_mode(POLL_IDLE);
+}
 
-    // Resolution read (0x8048 little-endian X, 0x804A little-endian Y) – many panels report odd values; for log only
-    uint8_t cfg_reg[2] = { 0x80, 0x47 };
-    uint8_t cfg[8] = {0};
-    if (i2c_read(s_addr, cfg_reg, 2, cfg, 7)) {
-      uint16_t x = (uint16_t)cfg[2] | ((uint16_t)cfg[3] << 8);
-      uint16_t y = (uint16_t)cfg[4] | ((uint16_t)cfg[5] << 8);
-      Serial.printf("[touch][GT] cfg (raw): %u x %u (ignored for mapping)\n", x, y);
-    }
-    return;
-  }
+void touch_poll_kick() {
+  if (s_int_pending && s_indev && s_poll == POLL_IDLE) lv_timer_ready(lv_indev_get_read_timer(s_indev));
+}
 
-  s_ic = TouchIC::NONE; s_addr = 0x00;
-  Serial.println(F("[touch] No FT/GT touch IC found (0x38/0x5D/0x14)"));
+// -------- Async sampling on the bus task --------
+// touch_read_cb kicks a URGENT job and waits up to TOUCH_SAMPLE_WAIT_US for
+// it, so a read normally reports its own sample; if the bus is held longer it
+// goes on with the newest completed one.
+struct BusSample { TouchPoint p; bool pressed; uint32_t t_us, busy_us; };
+
+static portMUX_TYPE  s_sample_mux = portMUX_INITIALIZER_UNLOCKED;
+static BusSample     s_sample{};
+static bool          s_sample_fresh = false;
+static volatile bool s_sample_busy = false;
+static bool          s_sample_late = false;   // read cb stopped waiting for the running sample
+static BusSample     s_held{};           // what LVGL sees between fresh samples
+
+template <class D>
+static bool touch_sample_job(void*) {
+  BusSample bs{};
+  i2c_health_service();                      // no-op unless the bus is in an outage
+  bs.t_us = micros();
+  bs.pressed = i2c_health_ok() && D::read(bs.p);
+  bs.busy_us = micros() - bs.t_us;
+  portENTER_CRITICAL(&s_sample_mux);
+  s_sample = bs; s_sample_fresh = true;
+  portEXIT_CRITICAL(&s_sample_mux);
+  return true;
+}
+// A sample that outlived the read cb's wait makes the next read due at once
+static void touch_sample_done(void*, bool) {
+  portENTER_CRITICAL(&s_sample_mux);
+  s_sample_busy = false;
+  const bool late = s_sample_late;
+  s_sample_late = false;
+  portEXIT_CRITICAL(&s_sample_mux);
+  if (late && s_indev) {
+    lv_timer_ready(lv_indev_get_read_timer(s_indev));
+    ui_wake();
+  }
 }
 
-// -------- LVGL read cb --------
+// -------- LVGL read cb (one instantiation per driver) --------
+template <class D>
 static void touch_read_cb(lv_indev_t*, lv_indev_data_t* data) {
   data->continue_reading = false;
   data->point.x = 0; data->point.y = 0;
   data->state = LV_INDEV_STATE_RELEASED;
 
-  if (s_ic == TouchIC::FT6X36) {
-    if (s_ft.touched()) {
-      TS_Point p = s_ft.getPoint();
-      int16_t x = p.x, y = p.y;
-      orient_map(x,y);
-      data->point.x = x; data->point.y = y;
-      data->state = LV_INDEV_STATE_PRESSED;
-    }
+  // Idle with INT wired: nothing to read until the controller raises INT
+  if (TOUCH_INT_PIN >= 0 && s_poll == POLL_IDLE && !s_int_pending) {
+    touch_trace_record(data);
     return;
   }
+  s_int_pending = false;
 
-  if (s_ic == TouchIC::GT911) {
-    bool pressed = false; int16_t x=0, y=0;
-
-#if HAVE_GT911_LIB
-    if (s_gt_using_lib) {
-      s_gt.read();
-      if (s_gt.isTouched()) {
-        auto pt = s_gt.getPoint(0);
-        x = pt.x; y = pt.y; pressed = true;
-      }
-    } else
-#endif
-    {
-      // raw minimal read (with robust ack/clear)
-      uint8_t status = 0;
-      uint8_t regS[2] = { uint8_t(GT_REG_STATUS>>8), uint8_t(GT_REG_STATUS & 0xFF) };
-      if (i2c_read(s_addr, regS, 2, &status, 1)) {
-        uint8_t n = status & 0x0F;
-        bool buf_ready = status & 0x80;
-
-        if (buf_ready) {
-          // Try read first point anyway
-          uint8_t regP[2] = { uint8_t(GT_REG_POINTS>>8), uint8_t(GT_REG_POINTS & 0xFF) };
-          GTPointRaw pr{};
-          if (i2c_read(s_addr, regP, 2, (uint8_t*)&pr, sizeof(pr))) {
-            if (n > 0 && pr.x != 0xFFFF && pr.y != 0xFFFF) {
-              x = (int16_t)pr.x; y = (int16_t)pr.y; pressed = true;
-            }
-            // Periodic debug
-            static uint32_t last_dump = 0;
-            uint32_t now = millis();
-            if (now - last_dump > 700) {
-              Serial.printf("[touch][GT] status=0x%02X n=%u peek: x=%u y=%u id=%u size=%u\n",
-                            status, n, pr.x, pr.y, pr.id, pr.size);
-              last_dump = now;
-            }
-          }
-          // ACK/CLEAR the buffer-ready flag ALWAYS
-          (void)i2c_write_u8(s_addr, GT_REG_STATUS, 0x00);
-        }
-      }
-    }
+  // Kick the next sample (runs inline before the bus manager is started)
+  if (!s_sample_busy) {
+    s_sample_busy = true;
+    if (!i2c_bus_submit(I2cClient::TOUCH, I2cPrio::URGENT, touch_sample_job<D>, nullptr, touch_sample_done))
+      s_sample_busy = false;
+  }
+  // The bus task runs on the other core: a short spin, no context switch
+  for (const uint32_t t0 = micros(); s_sample_busy && micros() - t0 < TOUCH_SAMPLE_WAIT_US; ) {}
+
+  bool fresh;
+  portENTER_CRITICAL(&s_sample_mux);
+  s_sample_late = s_sample_busy;
+  fresh = s_sample_fresh;
+  if (fresh) { s_held = s_sample; s_sample_fresh = false; }
+  portEXIT_CRITICAL(&s_sample_mux);
+
+  if (fresh) {
+    PollStats& ps = s_ps[s_poll];
+    ps.reads++; ps.busy_us += s_held.busy_us;
+    lat_input_sample(s_held.t_us);
+    if (s_held.pressed) cal_map(s_held.p.x, s_held.p.y);
+  }
+  if (s_held.pressed && s_wake_fn) {
+    void (*fn)() = s_wake_fn;
+    s_wake_fn = nullptr;
+    s_swallow = true;
+    fn();
+  }
+  if (s_swallow && !s_held.pressed) s_swallow = false;
+  if (s_held.pressed && !s_swallow) {
+    data->point.x = s_held.p.x; data->point.y = s_held.p.y;
+    data->state = LV_INDEV_STATE_PRESSED;
+  }
+  touch_trace_record(data);
 
-    if (pressed) {
-      orient_map(x,y);
-      data->point.x = x; data->point.y = y;
-      data->state = LV_INDEV_STATE_PRESSED;
-    }
+  const uint32_t now = millis();
+  if (s_wake_fn) {                         // asleep: stay idle
+    if (s_poll != POLL_IDLE) set_poll_mode(POLL_IDLE);
+    return;
+  }
+  if (data->state == LV_INDEV_STATE_PRESSED || s_swallow) {
+    s_last_contact_ms = now;
+    if (s_poll != POLL_ACTIVE) set_poll_mode(POLL_ACTIVE);
+  } else if (s_poll == POLL_ACTIVE && now - s_last_contact_ms > TOUCH_IDLE_AFTER_MS) {
+    set_poll_mode(POLL_IDLE);
+  }
+}
+
+void touch_print_stats(Stream& out) {
+  static const char* const kName[POLL_MODES] = { "active", "idle" };
+  const uint32_t now = millis();
+  uint32_t reads = 0, busy_us = 0, wall_ms = 0;
+  out.printf("[touch][poll] mode=%s  int=%s\n", kName[s_poll], TOUCH_INT_PIN >= 0 ? "yes" : "no");
+  for (int m = 0; m < POLL_MODES; ++m) {
+    PollStats ps = s_ps[m];
+    if (m == s_poll) ps.wall_ms += now - s_poll_since_ms;
+    out.printf("[touch][poll] %-6s %8lu s  reads=%lu  bus=%lu ms (%.3f%%)\n", kName[m],
+               (unsigned long)(ps.wall_ms / 1000), (unsigned long)ps.reads, (unsigned long)(ps.busy_us / 1000),
+               ps.wall_ms ? 100.0 * ps.busy_us / (ps.wall_ms * 1000.0) : 0.0);
+    reads += ps.reads; busy_us += ps.busy_us; wall_ms += ps.wall_ms;
+  }
+  // What the old fixed-period poll would have cost over the same time
+  if (reads && wall_ms) {
+    const uint32_t fixed_reads = wall_ms / LV_DEF_REFR_PERIOD;
+    const double   avg_us      = double(busy_us) / reads;
+    out.printf("[touch][poll] fixed %u ms poll would be %lu reads / %.0f ms bus; saved %.0f ms\n",
+               (unsigned)LV_DEF_REFR_PERIOD, (unsigned long)fixed_reads, fixed_reads * avg_us / 1000.0,
+               (fixed_reads * avg_us - busy_us) / 1000.0);
   }
 }
 
 // -------- Public API --------
 void touch_init_and_register_lvgl() {
   // Ensure Wire is alive and bus released
-  Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
-  Wire.setClock(TOUCH_I2C_FREQ);
-  delay(3);
-  (void)i2c_bus_recover(); // harmless if bus already free
-  i2c_full_scan_print(Serial);   // log addresses
+  (void)i2c_bus_call(I2cClient::TOUCH, I2cPrio::NORMAL, []{
+    Wire.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL);
+    Wire.setClock(i2c_clock_hz());
+    delay(3);
+    return i2c_bus_recover(); // harmless if bus already free
+  });
+  if (i2c_registry_scanned()) i2c_registry_print(Serial);   // scan itself is the caller's call (fast boot skips it)
 
   detect_ic();
 
-  if (s_ic == TouchIC::FT6X36) {
-    if (!s_ft.begin(30)) {
-      Serial.println(F("[touch] FT6x36 begin() failed"));
-      s_ic = TouchIC::NONE;
-    } else {
-      Serial.println(F("[touch] FT6x36 ready"));
-    }
-  } else if (s_ic == TouchIC::GT911) {
-#if HAVE_GT911_LIB
-    s_gt_using_lib = s_gt.begin(TOUCH_I2C_SDA, TOUCH_I2C_SCL, s_addr, TOUCH_RST_PIN, TOUCH_INT_PIN);
-    if (s_gt_using_lib) Serial.println(F("[touch] GT911 library initialized"));
-    else                Serial.println(F("[touch] GT911 lib init failed; using raw I2C"));
-#else
-    s_gt_using_lib = false;
-    Serial.println(F("[touch] GT911 lib not present; using raw I2C"));
-#endif
-  }
-
   if (s_ic != TouchIC::NONE) {
-    // Speed up after detection if you like (stays at header-defined freq)
-    Wire.setClock(TOUCH_I2C_FREQ);
-    s_indev = lv_indev_create();
-    lv_indev_set_type(s_indev, LV_INDEV_TYPE_POINTER);
-    lv_indev_set_read_cb(s_indev, touch_read_cb);
+    const bool first = !s_indev;   // called again: re-detected, same indev rebound
+    if (first) {
+      s_indev = lv_indev_create();
+      lv_indev_set_type(s_indev, LV_INDEV_TYPE_POINTER);
+    }
+    lv_indev_set_read_cb(s_indev, s_read_cb);
+    lv_indev_enable(s_indev, true);
+    s_poll_since_ms = s_last_contact_ms = millis();
+    set_poll_mode(POLL_ACTIVE);
+    if (first && TOUCH_INT_PIN >= 0) attachInterrupt(digitalPinToInterrupt(TOUCH_INT_PIN), touch_int_isr, TOUCH_INT_EDGE);
     Serial.printf("[touch] LVGL indev registered (%s @ 0x%02X)  I2C=%u Hz\n",
-                  (s_ic==TouchIC::FT6X36 ? "FT6x36":"GT911"), s_addr, (unsigned)TOUCH_I2C_FREQ);
-    Serial.printf("[touch] Calibration offsets: X=%d  Y=%d\n", (int)TOUCH_X_OFFSET, (int)TOUCH_Y_OFFSET);
+                  s_ic_name, s_addr, (unsigned)i2c_clock_hz());
+    const bool stored = touch_calib_load();
+    Serial.printf("[touch] Calibration: %s\n", stored ? "NVS affine" : "compile-time orientation/offsets");
   } else {
+    if (s_indev) lv_indev_enable(s_indev, false);
     Serial.println(F("[touch] Skipping LVGL indev (no touch detected)"));
   }
 }
 
 bool touch_present() { return s_ic != TouchIC::NONE; }
-const char* touch_ic_name() {
-  switch (s_ic) {
-    case TouchIC::FT6X36: return "FT6x36";
-    case TouchIC::GT911:  return "GT911";
-    default:              return "NONE";
-  }
+bool touch_reinit_now() {
+  return s_restart && i2c_bus_call(I2cClient::TOUCH, I2cPrio::NORMAL, s_restart);
 }
+void touch_on_hw_reset(TouchHwResetFn fn) { s_hw_reset = fn; }
+TouchIC touch_ic() { return s_ic; }
+const char* touch_ic_name() { return s_ic_name; }
 uint8_t touch_i2c_address() { return s_addr; }
+lv_indev_t* touch_indev() { return s_indev; }
+
+TouchAffine touch_default_affine() {
+  // Compose swap -> invert -> offset into one matrix (same order the old orient_map used)
+  constexpr int32_t ONE = 1 << 16, HALF = 1 << 15;
+  constexpr int32_t sx = TOUCH_INVERT_X ? -ONE : ONE;
+  constexpr int32_t sy = TOUCH_INVERT_Y ? -ONE : ONE;
+  TouchAffine m{};
+  m.a = TOUCH_SWAP_XY ? 0 : sx;   m.b = TOUCH_SWAP_XY ? sx : 0;
+  m.d = TOUCH_SWAP_XY ? sy : 0;   m.e = TOUCH_SWAP_XY ? 0 : sy;
+  m.c = ((TOUCH_INVERT_X ? TOUCH_SCREEN_W - 1 : 0) + TOUCH_X_OFFSET) * ONE + HALF;
+  m.f = ((TOUCH_INVERT_Y ? TOUCH_SCREEN_H - 1 : 0) + TOUCH_Y_OFFSET) * ONE + HALF;
+  return m;
+}
+TouchAffine touch_get_affine() { return s_cal; }
+void touch_set_affine(const TouchAffine& m) { s_cal = m; }
+bool touch_last_raw(int16_t& x, int16_t& y) {
+  x = s_raw_x; y = s_raw_y;
+  return s_raw_valid;
+}
@@ -0,0 +1,242 @@
+// src/touch_trace.cpp
+#include "touch_trace.h"
+#include "touch_input.h"
+#include "latency_trace.h"
+#include <Arduino.h>
+#include <lvgl.h>
+
+#ifdef ESP_PLATFORM
+  #include <esp_heap_caps.h>
+#endif
+#if __has_include(<LittleFS.h>)
+  #include <LittleFS.h>
+  #define HAVE_TRACE_FS 1
+#else
+  #define HAVE_TRACE_FS 0
+#endif
+
+static constexpr uint8_t TRACE_VERSION = 1;
+
+static TouchTraceSample* s_buf = nullptr;
+static size_t   s_count = 0;
+
+// recorder
+static bool     s_rec = false;
+static uint32_t s_rec_last_ms = 0;
+static uint16_t s_rec_last_xs = 0xFFFF, s_rec_last_y = 0xFFFF;
+
+// replay
+static lv_indev_t* s_rp_indev = nullptr;
+static bool     s_rp = false;
+static bool     s_rp_done = false;
+static uint8_t  s_rp_speed = 1;
+static uint32_t s_rp_start = 0;
+static uint32_t s_rp_due = 0;      // trace time (ms) at which s_rp_pos becomes current
+static size_t   s_rp_pos = 0;
+static TouchTraceSample s_rp_cur{};
+
+// frame stats while replaying
+static uint32_t s_fr_count = 0, s_fr_sum_us = 0, s_fr_max_us = 0, s_fr_t0 = 0;
+
+static bool ensure_buf() {
+  if (s_buf) return true;
+  const size_t bytes = TOUCH_TRACE_MAX_SAMPLES * sizeof(TouchTraceSample);
+#ifdef ESP_PLATFORM
+  s_buf = (TouchTraceSample*) heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+#else
+  s_buf = (TouchTraceSample*) malloc(bytes);
+#endif
+  if (!s_buf) Serial.println(F("[trace] buffer alloc failed"));
+  return s_buf != nullptr;
+}
+
+static inline bool push(uint16_t dt, uint16_t xs, uint16_t y) {
+  if (s_count >= TOUCH_TRACE_MAX_SAMPLES) return false;
+  s_buf[s_count++] = { dt, xs, y };
+  return true;
+}
+
+// -------- Recorder --------
+void touch_trace_start() {
+  if (s_rp || !ensure_buf()) return;
+  s_count = 0;
+  s_rec_last_ms = lv_tick_get();
+  s_rec_last_xs = 0xFFFF; s_rec_last_y = 0xFFFF;
+  s_rec = true;
+  Serial.printf("[trace] recording (max %u samples)\n", (unsigned)TOUCH_TRACE_MAX_SAMPLES);
+}
+
+void touch_trace_stop() {
+  if (!s_rec) return;
+  s_rec = false;
+  Serial.printf("[trace] stopped: %u samples\n", (unsigned)s_count);
+  (void)touch_trace_save();
+}
+
+bool touch_trace_recording() { return s_rec; }
+
+void touch_trace_record(const lv_indev_data_t* data) {
+  if (!s_rec) return;
+  const bool pressed = (data->state == LV_INDEV_STATE_PRESSED);
+  const uint16_t xs = uint16_t((data->point.x & 0x7FFF) | (pressed ? 0x8000 : 0));
+  const uint16_t y  = uint16_t(data->point.y);
+  if (xs == s_rec_last_xs && y == s_rec_last_y) return;   // holds until next change
+
+  const uint32_t now = lv_tick_get();
+  uint32_t dt = now - s_rec_last_ms;
+  // Long idle gaps: repeat the previous sample so dt fits in 16 bits
+  while (dt > 0xFFFF && s_rec_last_xs != 0xFFFF) {
+    if (!push(0xFFFF, s_rec_last_xs, s_rec_last_y)) break;
+    dt -= 0xFFFF;
+  }
+  if (dt > 0xFFFF) dt = 0xFFFF;
+  if (!push(uint16_t(dt), xs, y)) {
+    Serial.println(F("[trace] buffer full"));
+    touch_trace_stop();
+    return;
+  }
+  s_rec_last_ms = now; s_rec_last_xs = xs; s_rec_last_y = y;
+}
+
+// -------- Replay --------
+static void frame_event_cb(lv_event_t* e) {
+  if (!s_rp) return;
+  if (lv_event_get_code(e) == LV_EVENT_REFR_START) { s_fr_t0 = micros(); return; }
+  const uint32_t us = micros() - s_fr_t0;
+  s_fr_count++; s_fr_sum_us += us;
+  if (us > s_fr_max_us) s_fr_max_us = us;
+}
+
+static void replay_finish() {
+  s_rp = false;
+  lv_indev_enable(s_rp_indev, false);
+  if (touch_indev()) lv_indev_enable(touch_indev(), true);
+  const uint32_t wall = lv_tick_elaps(s_rp_start);
+  Serial.printf("[trace] replay done: %u samples in %lu ms (x%u)  frames=%lu avg=%lu us max=%lu us\n",
+                (unsigned)s_count, (unsigned long)wall, (unsigned)s_rp_speed,
+                (unsigned long)s_fr_count,
+                (unsigned long)(s_fr_count ? s_fr_sum_us / s_fr_count : 0),
+                (unsigned long)s_fr_max_us);
+}
+
+static void replay_read_cb(lv_indev_t*, lv_indev_data_t* data) {
+  data->continue_reading = false;
+  if (!s_rp) { data->state = LV_INDEV_STATE_RELEASED; return; }
+  lat_input_sample(micros());
+
+  // One sample per read; while more are due LVGL reads again at once, so a
+  // press + release that both fall between two timer ticks still gives two edges
+  const uint32_t t = lv_tick_elaps(s_rp_start) * s_rp_speed;
+  if (s_rp_pos < s_count && t >= s_rp_due) {
+    s_rp_cur = s_buf[s_rp_pos++];
+    if (s_rp_pos < s_count) {
+      s_rp_due += s_buf[s_rp_pos].dt_ms;
+      data->continue_reading = t >= s_rp_due;
+    }
+  }
+
+  data->point.x = s_rp_cur.x_state & 0x7FFF;
+  data->point.y = s_rp_cur.y;
+  data->state = (s_rp_cur.x_state & 0x8000) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+
+  // End of trace: report one RELEASED so widgets see the end of any drag, then hand back
+  if (s_rp_pos >= s_count) {
+    if (s_rp_done) { data->state = LV_INDEV_STATE_RELEASED; replay_finish(); }
+    s_rp_done = true;
+  }
+}
+
+bool touch_trace_replay(uint8_t speed_x) {
+  if (s_rec || s_rp) return false;
+  if (s_count == 0 && !touch_trace_load()) {
+    Serial.println(F("[trace] nothing to replay"));
+    return false;
+  }
+  if (!s_rp_indev) {
+    s_rp_indev = lv_indev_create();
+    lv_indev_set_type(s_rp_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(s_rp_indev, replay_read_cb);
+    lv_display_t* disp = lv_display_get_default();
+    if (disp) {
+      lv_display_add_event_cb(disp, frame_event_cb, LV_EVENT_REFR_START, nullptr);
+      lv_display_add_event_cb(disp, frame_event_cb, LV_EVENT_REFR_READY, nullptr);
+    }
+  }
+  if (touch_indev()) lv_indev_enable(touch_indev(), false);   // keep real fingers out of the run
+
+  s_rp_speed = speed_x ? speed_x : 1;
+  s_rp_pos = 0; s_rp_due = s_buf[0].dt_ms; s_rp_done = false;
+  s_rp_cur = { 0, 0, 0 };
+  s_fr_count = 0; s_fr_sum_us = 0; s_fr_max_us = 0;
+  s_rp_start = lv_tick_get();
+  s_rp = true;
+  lv_indev_enable(s_rp_indev, true);
+  Serial.printf("[trace] replaying %u samples at x%u\n", (unsigned)s_count, (unsigned)s_rp_speed);
+  return true;
+}
+
+bool touch_trace_replaying() { return s_rp; }
+size_t touch_trace_count() { return s_count; }
+
+// -------- Storage / export --------
+static void make_header(uint8_t* h) {
+  h[0]='T'; h[1]='T'; h[2]='R'; h[3]='C';
+  h[4]=TRACE_VERSION; h[5]=0;
+  h[6]=uint8_t(s_count & 0xFF); h[7]=uint8_t((s_count >> 8) & 0xFF);
+}
+
+bool touch_trace_save(const char* path) {
+#if HAVE_TRACE_FS
+  if (!s_buf || s_count == 0) return false;
+  if (!LittleFS.begin(true)) { Serial.println(F("[trace] LittleFS mount failed")); return false; }
+  File f = LittleFS.open(path, "w");
+  if (!f) return false;
+  uint8_t h[8]; make_header(h);
+  bool ok = f.write(h, sizeof(h)) == sizeof(h) &&
+            f.write((const uint8_t*)s_buf, s_count * sizeof(TouchTraceSample)) == s_count * sizeof(TouchTraceSample);
+  f.close();
+  Serial.printf("[trace] save %s -> %s\n", path, ok ? "ok" : "FAILED");
+  return ok;
+#else
+  (void)path;
+  return false;
+#endif
+}
+
+bool touch_trace_load(const char* path) {
+#if HAVE_TRACE_FS
+  if (!ensure_buf() || !LittleFS.begin(true)) return false;
+  File f = LittleFS.open(path, "r");
+  if (!f) return false;
+  uint8_t h[8];
+  size_t n = 0;
+  if (f.read(h, sizeof(h)) == sizeof(h) && memcmp(h, "TTRC", 4) == 0 && h[4] == TRACE_VERSION) {
+    n = (size_t)h[6] | ((size_t)h[7] << 8);
+    if (n > TOUCH_TRACE_MAX_SAMPLES) n = TOUCH_TRACE_MAX_SAMPLES;
+    n = f.read((uint8_t*)s_buf, n * sizeof(TouchTraceSample)) / sizeof(TouchTraceSample);
+  }
+  f.close();
+  s_count = n;
+  Serial.printf("[trace] load %s -> %u samples\n", path, (unsigned)n);
+  return n > 0;
+#else
+  (void)path;
+  return false;
+#endif
+}
+
+void touch_trace_dump(Stream& out) {
+  if (!s_buf) { out.println(F("[trace] empty")); return; }
+  uint8_t h[8]; make_header(h);
+  out.println(F("TTRC-BEGIN"));
+  for (uint8_t b : h) out.printf("%02X", b);
+  out.println();
+  const uint8_t* p = (const uint8_t*)s_buf;
+  const size_t bytes = s_count * sizeof(TouchTraceSample);
+  for (size_t i = 0; i < bytes; ++i) {
+    out.printf("%02X", p[i]);
+    if ((i % 48) == 47) out.println();
+  }
+  out.println();
+  out.println(F("TTRC-END"));
+}
@@ -0,0 +1,103 @@
+#pragma once
+/* ---------------- Host Arduino layer (native env only) -----------------
+ * Just enough of the Arduino core for the bus-level modules to build and
+ * run on the host (pio test -e native). Time is virtual: delay() and
+ * delayMicroseconds() advance the clock instead of sleeping, so reset and
+ * recovery sequences run at full host speed and deterministically.
+ * Serial output is discarded unless host::serial_echo is set.
+ * Header-only on purpose: -I test/host is the whole integration.
+ * ----------------------------------------------------------------------- */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define F(s) (s)
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace host {
+inline uint64_t now_us = 0;
+inline bool     serial_echo = false;
+inline void advance_us(uint64_t us) { now_us += us; }
+inline void advance_ms(uint32_t ms) { now_us += (uint64_t)ms * 1000u; }
+
+// GPIO: levels as last written; inputs read high (pull-ups) unless forced
+inline uint8_t pin_level[64];
+inline bool    pin_forced[64];
+inline void gpio_force(int pin, uint8_t level) { pin_forced[pin] = true; pin_level[pin] = level; }
+inline void gpio_release(int pin) { pin_forced[pin] = false; pin_level[pin] = HIGH; }
+}
+
+inline unsigned long millis() { return (unsigned long)(host::now_us / 1000u); }
+inline unsigned long micros() { return (unsigned long)host::now_us; }
+inline void delay(uint32_t ms) { host::advance_ms(ms); }
+inline void delayMicroseconds(uint32_t us) { host::advance_us(us); }
+inline void yield() {}
+
+inline void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < 64 && !host::pin_forced[pin] && mode != OUTPUT) host::pin_level[pin] = HIGH;
+}
+inline void digitalWrite(uint8_t pin, uint8_t v) { if (pin < 64 && !host::pin_forced[pin]) host::pin_level[pin] = v ? HIGH : LOW; }
+inline int  digitalRead(uint8_t pin) { return pin < 64 ? host::pin_level[pin] : LOW; }
+inline int  digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void detachInterrupt(int) {}
+
+class Print {
+public:
+  virtual ~Print() = default;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    if (host::serial_echo) fwrite(buf, 1, n, stdout);
+    return n;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  size_t println() { return print("\r\n"); }
+  template <typename T> size_t println(T v) { const size_t n = print(v); return n + println(); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, std::min<size_t>((size_t)n, sizeof(buf) - 1));
+  }
+  void flush() { if (host::serial_echo) fflush(stdout); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+};
+
+class HostSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  explicit operator bool() const { return true; }
+};
+inline HostSerial Serial;
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/* Host stand-in for the NVS-backed Preferences: one in-memory store per
+   process (host::nvs_clear() between tests). */
+namespace host {
+inline std::map<std::string, std::vector<uint8_t>> nvs;
+inline void nvs_clear() { nvs.clear(); }
+}
+
+class Preferences {
+public:
+  bool begin(const char* ns, bool read_only = false) { ns_ = ns; ro_ = read_only; return true; }
+  void end() {}
+  size_t getBytes(const char* key, void* buf, size_t len) {
+    auto it = host::nvs.find(ns_ + "/" + key);
+    if (it == host::nvs.end() || it->second.size() > len) return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+  size_t putBytes(const char* key, const void* buf, size_t len) {
+    if (ro_) return 0;
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    host::nvs[ns_ + "/" + key].assign(p, p + len);
+    return len;
+  }
+  bool remove(const char* key) { return !ro_ && host::nvs.erase(ns_ + "/" + key) > 0; }
+private:
+  std::string ns_;
+  bool ro_ = false;
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+
+/* Host stand-in for Wire: an empty bus (every address NACKs). The native
+   env builds with I2C_BACKEND_SIM=1, so transfers go to i2c_sim instead. */
+class TwoWire {
+public:
+  bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+  bool end() { return true; }
+  bool setClock(uint32_t) { return true; }
+  void beginTransmission(uint8_t) {}
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+  uint8_t endTransmission(bool = true) { return 2; }
+  uint8_t requestFrom(int, int) { return 0; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+inline TwoWire Wire;
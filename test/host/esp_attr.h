@@ -0,0 +1,5 @@
+#pragma once
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+#define RTC_NOINIT_ATTR
@@ -0,0 +1,25 @@
+#pragma once
+#include "FreeRTOS.h"
+#include <deque>
+#include <vector>
+#include <string.h>
+
+/* Bounded FIFO of fixed-size items; enough for single-threaded use */
+struct HostQueue { size_t len, item; std::deque<std::vector<uint8_t>> q; };
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item) { return new HostQueue{ len, item, {} }; }
+inline void vQueueDelete(QueueHandle_t q) { delete q; }
+inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t) {
+  if (q->q.size() >= q->len) return pdFALSE;
+  const uint8_t* p = static_cast<const uint8_t*>(item);
+  q->q.emplace_back(p, p + q->item);
+  return pdTRUE;
+}
+inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t) {
+  if (q->q.empty()) return pdFALSE;
+  memcpy(item, q->q.front().data(), q->item);
+  q->q.pop_front();
+  return pdTRUE;
+}
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) { return (UBaseType_t)q->q.size(); }
@@ -0,0 +1,15 @@
+#pragma once
+#include "FreeRTOS.h"
+
+struct HostSemaphore { bool given; };
+typedef HostSemaphore* SemaphoreHandle_t;
+typedef HostSemaphore  StaticSemaphore_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buf) { buf->given = false; return buf; }
+inline void vSemaphoreDelete(SemaphoreHandle_t) {}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { s->given = true; return pdTRUE; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t) {
+  if (!s->given) return pdFALSE;
+  s->given = false;
+  return pdTRUE;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+#include "touch_input.h"
+
+/* Shared LVGL fixture for the host tests: a display that drops its frames,
+   LVGL time from the virtual clock, press/release counting, and one
+   synchronous read of the touch indev. */
+namespace host {
+
+inline uint32_t lv_tick() { return millis(); }
+inline void lv_flush(lv_display_t* d, const lv_area_t*, uint8_t*) { lv_display_flush_ready(d); }
+
+inline lv_display_t* lv_setup() {
+  static uint8_t buf[TOUCH_SCREEN_W * 40 * 2];
+  lv_init();
+  lv_tick_set_cb(lv_tick);
+  lv_display_t* d = lv_display_create(TOUCH_SCREEN_W, TOUCH_SCREEN_H);
+  lv_display_set_buffers(d, buf, nullptr, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_cb(d, lv_flush);
+  lv_obj_clear_flag(lv_screen_active(), LV_OBJ_FLAG_SCROLLABLE);   // drags stay presses
+  return d;
+}
+
+// PRESSED / RELEASED events delivered to one object
+struct Edges { uint32_t pressed = 0, released = 0; };
+inline void lv_count_edges(lv_obj_t* obj, Edges* e) {
+  lv_obj_add_event_cb(obj, [](lv_event_t* ev) {
+    Edges& n = *static_cast<Edges*>(lv_event_get_user_data(ev));
+    const lv_event_code_t code = lv_event_get_code(ev);
+    if (code == LV_EVENT_PRESSED) n.pressed++;
+    else if (code == LV_EVENT_RELEASED) n.released++;
+  }, LV_EVENT_ALL, e);
+}
+
+inline lv_indev_state_t read_touch(lv_point_t* p = nullptr) {
+  lv_indev_read(touch_indev());
+  if (p) lv_indev_get_point(touch_indev(), p);
+  return lv_indev_get_state(touch_indev());
+}
+
+}  // namespace host
@@ -0,0 +1,241 @@
+// test/test_i2c_sim/test_main.cpp
+// Bus-level modules against the simulated I2C bus (pio test -e native):
+// registry scan, touch detection, the touch read path into LVGL, and bus
+// recovery under stuck-SDA / NACK faults.
+#include <unity.h>
+#include <lvgl.h>
+#include <Preferences.h>
+#include "lv_host.h"
+#include "i2c_sim.h"
+#include "i2c_bus.h"
+#include "i2c_health.h"
+#include "i2c_registry.h"
+#include "hw_cache.h"
+#include "touch_input.h"
+
+// -------- Fixture --------
+// Waveshare 4.3B as the simulator models it: CH422G + GT911 (INT=EXIO7, RST=EXIO6)
+static void board_reset() {
+  i2c_sim_reset();
+  i2c_sim_add_ch422g();
+  i2c_sim_add_gt911(0x5D);
+  i2c_sim_wire_gt911_reset(7, 6);
+}
+
+using host::read_touch;
+
+// Drive the read path until the failure monitor declares an outage
+static void read_until_outage() {
+  for (int i = 0; i < I2C_HEALTH_FAIL_RUN * 4 && i2c_health_ok(); ++i) (void)read_touch();
+}
+
+// Bus task loop on virtual time: service recovery until healthy
+static uint32_t service_until_ok(uint32_t max_ms) {
+  uint32_t waited = 0;
+  while (!i2c_health_ok() && waited <= max_ms) {
+    i2c_health_service();
+    const uint32_t w = i2c_health_ok() ? 0 : std::max<uint32_t>(i2c_health_wait_ms(), 1);
+    delay(w);
+    waited += w;
+  }
+  return waited;
+}
+
+void setUp() {
+  board_reset();
+  host::nvs_clear();
+  hw_cache_clear();
+}
+void tearDown() {}
+
+// -------- Scan --------
+static void test_scan_finds_board() {
+  i2c_registry_scan();
+  TEST_ASSERT_TRUE(i2c_registry_scanned());
+  TEST_ASSERT_TRUE(i2c_registry_present(0x24));    // CH422G WR_SET
+  TEST_ASSERT_TRUE(i2c_registry_present(0x5D));    // GT911 (INT low at reset)
+  TEST_ASSERT_FALSE(i2c_registry_present(0x14));
+  TEST_ASSERT_FALSE(i2c_registry_present(0x15));   // no CST816 on this board
+
+  char box[256];
+  TEST_ASSERT_GREATER_THAN(0, (int)i2c_registry_format(box, sizeof(box), "test"));
+  TEST_ASSERT_NOT_NULL(strstr(box, "0x5D"));
+}
+
+// -------- Detection --------
+static void test_detect_gt911() {
+  touch_init_and_register_lvgl();
+  TEST_ASSERT_TRUE(touch_present());
+  TEST_ASSERT_EQUAL_STRING("GT911", touch_ic_name());
+  TEST_ASSERT_EQUAL_HEX8(0x5D, touch_i2c_address());
+  TEST_ASSERT_NOT_NULL(touch_indev());
+  TEST_ASSERT_TRUE(hw_cache().touch_ic == TouchIC::GT911);
+  TEST_ASSERT_TRUE(touch_ic() == TouchIC::GT911);
+
+  // Full discovery again (FT probe, GT911 ID + config read): same indev rebound
+  lv_indev_t* indev = touch_indev();
+  hw_cache_clear();
+  touch_init_and_register_lvgl();
+  TEST_ASSERT_EQUAL_PTR(indev, touch_indev());
+  TEST_ASSERT_EQUAL_STRING("GT911", touch_ic_name());
+}
+
+static void test_detect_nothing() {
+  i2c_sim_reset();                                 // empty bus
+  touch_init_and_register_lvgl();
+  TEST_ASSERT_FALSE(touch_present());
+  TEST_ASSERT_TRUE(touch_ic() == TouchIC::NONE);
+  TEST_ASSERT_TRUE(hw_cache().touch_ic == TouchIC::NONE);
+  board_reset();
+  touch_init_and_register_lvgl();                  // back for the following cases
+  TEST_ASSERT_TRUE(touch_present());
+}
+
+// -------- Read path --------
+static void test_read_path() {
+  touch_init_and_register_lvgl();
+  touch_set_affine(touch_default_affine());
+  lv_point_t p;
+
+  i2c_sim_touch(true, 100, 200);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(100 + TOUCH_X_OFFSET, p.x);
+  TEST_ASSERT_EQUAL(200 + TOUCH_Y_OFFSET, p.y);
+  int16_t rx, ry;
+  TEST_ASSERT_TRUE(touch_last_raw(rx, ry));
+  TEST_ASSERT_EQUAL(100, rx);
+  TEST_ASSERT_EQUAL(200, ry);
+
+  i2c_sim_touch(false);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, read_touch());
+
+  i2c_sim_touch(false);
+  (void)read_touch();
+}
+
+// -------- Recovery --------
+static void test_recover_stuck_sda() {
+  i2c_sim_fault_stuck_sda(10);                     // released within one 16-pulse attempt
+  TEST_ASSERT_TRUE(i2c_bus_recover());
+  TEST_ASSERT_TRUE(i2c_probe(0x5D));
+
+  i2c_sim_fault_stuck_sda(40);                     // needs three attempts
+  TEST_ASSERT_FALSE(i2c_probe(0x5D));
+  TEST_ASSERT_FALSE(i2c_bus_recover());
+  TEST_ASSERT_FALSE(i2c_bus_recover());
+  TEST_ASSERT_TRUE(i2c_bus_recover());
+  TEST_ASSERT_TRUE(i2c_probe(0x5D));
+
+}
+
+static void test_outage_stuck_sda() {
+  touch_init_and_register_lvgl();
+  i2c_sim_touch(true, 300, 100);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());
+
+  i2c_sim_fault_stuck_sda(40);
+  read_until_outage();
+  TEST_ASSERT_FALSE(i2c_health_ok());
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, read_touch());   // no bus traffic while down
+
+  const uint32_t waited = service_until_ok(1000);
+  TEST_ASSERT_TRUE(i2c_health_ok());
+  TEST_ASSERT_LESS_THAN_UINT32(I2C_HEALTH_BACKOFF_MIN_MS * 4, waited);   // 3 attempts: 0, +5, +10 ms
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());
+
+  i2c_sim_touch(false);
+  (void)read_touch();
+}
+
+static void test_outage_nack() {
+  touch_init_and_register_lvgl();
+  i2c_sim_touch(true, 50, 60);
+  i2c_sim_fault_nack(0x5D, 1);                     // controller gone: every transfer NACKs
+  read_until_outage();
+  TEST_ASSERT_FALSE(i2c_health_ok());
+
+  // Bus itself recovers, but the re-init hook cannot reach the GT911: backoff
+  i2c_health_service();
+  TEST_ASSERT_FALSE(i2c_health_ok());
+  TEST_ASSERT_GREATER_THAN_UINT32(0, i2c_health_wait_ms());
+  TEST_ASSERT_GREATER_THAN_UINT32(100, service_until_ok(100));   // still down after 100 ms
+  TEST_ASSERT_FALSE(i2c_health_ok());
+
+  i2c_sim_fault_nack(0x5D, 0);                     // controller answers again
+  (void)service_until_ok(I2C_HEALTH_BACKOFF_MAX_MS + 1);
+  TEST_ASSERT_TRUE(i2c_health_ok());
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());
+  i2c_sim_touch(false);
+  (void)read_touch();
+}
+
+static void test_intermittent_nack() {
+  touch_init_and_register_lvgl();
+  i2c_sim_fault_nack(0x5D, 3);                     // every third transfer: below the outage threshold
+  for (int i = 0; i < 300; ++i) {
+    i2c_sim_touch((i & 1) == 0, 400, 200);
+    (void)read_touch();
+    TEST_ASSERT_TRUE(i2c_health_ok());
+  }
+  TEST_ASSERT_GREATER_THAN_UINT32(0, i2c_sim_stats().nacks);
+  i2c_sim_fault_nack(0x5D, 0);
+}
+
+// GT911 wedged with the bus: the failure monitor runs the board reset hook before re-init
+static uint32_t s_hw_resets = 0;
+static void test_outage_gt911_hw_reset() {
+  touch_init_and_register_lvgl();
+  touch_on_hw_reset([] {
+    s_hw_resets++;
+    i2c_sim_fault_nack(0x5D, 0);                   // the reset brings the controller back
+    return true;
+  });
+  s_hw_resets = 0;
+  i2c_sim_fault_nack(0x5D, 1);
+  read_until_outage();
+  TEST_ASSERT_FALSE(i2c_health_ok());
+  TEST_ASSERT_LESS_THAN_UINT32(I2C_HEALTH_BACKOFF_MIN_MS * 2, service_until_ok(1000));
+  TEST_ASSERT_TRUE(i2c_health_ok());
+  TEST_ASSERT_EQUAL(1, s_hw_resets);
+  touch_on_hw_reset(nullptr);
+}
+
+// FT6x36 reads go through i2c_read(): a controller that stops answering is an outage
+static void test_ft6x36_read() {
+  i2c_sim_reset();
+  i2c_sim_add_ft6x36();
+  touch_init_and_register_lvgl();
+  TEST_ASSERT_EQUAL_STRING("FT6x36", touch_ic_name());
+  lv_point_t p;
+  i2c_sim_touch(true, 120, 80);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(120 + TOUCH_X_OFFSET, p.x);
+  TEST_ASSERT_EQUAL(80 + TOUCH_Y_OFFSET, p.y);
+
+  i2c_sim_fault_nack(0x38, 1);
+  read_until_outage();
+  TEST_ASSERT_FALSE(i2c_health_ok());
+  i2c_sim_fault_nack(0x38, 0);
+  (void)service_until_ok(I2C_HEALTH_BACKOFF_MAX_MS + 1);
+  TEST_ASSERT_TRUE(i2c_health_ok());
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());
+  i2c_sim_touch(false);
+  (void)read_touch();
+}
+
+int main(int, char**) {
+  host::lv_setup();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_scan_finds_board);
+  RUN_TEST(test_detect_gt911);
+  RUN_TEST(test_detect_nothing);
+  RUN_TEST(test_read_path);
+  RUN_TEST(test_recover_stuck_sda);
+  RUN_TEST(test_outage_stuck_sda);
+  RUN_TEST(test_outage_nack);
+  RUN_TEST(test_intermittent_nack);
+  RUN_TEST(test_outage_gt911_hw_reset);
+  RUN_TEST(test_ft6x36_read);
+  return UNITY_END();
+}
@@ -0,0 +1,89 @@
+// test/test_seqlock/test_main.cpp
+// Host version of the on-target seqlock stress check ('S' in main.cpp):
+// one writer thread stores a payload whose every word carries the same
+// counter while the test thread reads in a loop. Any mismatch is a torn read;
+// a counter or version going backwards is an out-of-order read.
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "seqlock.h"
+
+#ifndef SEQLOCK_TEST_MS
+#define SEQLOCK_TEST_MS 1000
+#endif
+
+struct StressPayload { uint32_t w[8]; };
+
+void setUp() {}
+void tearDown() {}
+
+static void test_single_thread() {
+  SeqLock<StressPayload> sl;
+  StressPayload p{};
+  uint32_t v = 99;
+  TEST_ASSERT_TRUE(sl.try_load(p, &v));
+  TEST_ASSERT_EQUAL(0, v);
+  for (uint32_t c = 1; c <= 1000; ++c) {
+    for (uint32_t& x : p.w) x = c;
+    sl.store(p);
+    const StressPayload r = sl.load(&v);
+    TEST_ASSERT_EQUAL(c, v);
+    TEST_ASSERT_EQUAL(c, r.w[7]);
+  }
+  TEST_ASSERT_EQUAL(1000, sl.version());
+}
+
+static void test_writer_vs_reader() {
+  static SeqLock<StressPayload> sl;
+  std::atomic<bool> stop{false};
+  uint32_t writes = 0;
+
+  std::thread writer([&] {
+    StressPayload p;
+    uint32_t c = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      ++c;
+      for (uint32_t& x : p.w) x = c;
+      sl.store(p);
+    }
+    writes = c;
+  });
+
+  uint32_t reads = 0, torn = 0, backwards = 0, retries = 0, last = 0, last_ver = 0;
+  const auto t0 = std::chrono::steady_clock::now();
+  const auto until = t0 + std::chrono::milliseconds(SEQLOCK_TEST_MS);
+  while (std::chrono::steady_clock::now() < until) {
+    for (int i = 0; i < 256; ++i) {
+      uint32_t ver = 0;
+      const StressPayload p = sl.load(&ver, &retries);
+      reads++;
+      for (uint32_t x : p.w) if (x != p.w[0]) { torn++; break; }
+      if (ver != p.w[0]) torn++;                   // version and payload from different writes
+      if (p.w[0] < last || ver < last_ver) backwards++;
+      last = p.w[0];
+      last_ver = ver;
+    }
+  }
+  stop = true;
+  writer.join();
+  const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%u ms: %lu writes, %lu reads (%.0f reads/s), %lu retries, %lu torn, %lu out-of-order",
+           (unsigned)SEQLOCK_TEST_MS, (unsigned long)writes, (unsigned long)reads, reads / s,
+           (unsigned long)retries, (unsigned long)torn, (unsigned long)backwards);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_GREATER_THAN(0, reads);
+  TEST_ASSERT_GREATER_THAN(0, writes);
+  TEST_ASSERT_EQUAL(0, torn);
+  TEST_ASSERT_EQUAL(0, backwards);
+  TEST_ASSERT_EQUAL(writes, sl.version());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_single_thread);
+  RUN_TEST(test_writer_vs_reader);
+  return UNITY_END();
+}
@@ -0,0 +1,162 @@
+// test/test_touch_sim/test_main.cpp
+// touch_read_cb<SimTouchDriver> end to end (pio test -e native_simtouch):
+// injected / scripted raw points through the calibration map into LVGL,
+// press/release edges as the UI sees them, and the calibration screen from
+// first target to the fitted, stored affine.
+#include <unity.h>
+#include <lvgl.h>
+#include <Preferences.h>
+#include "touch_input.h"
+#include "touch_drivers.h"
+#include "touch_calib.h"
+#include "lv_host.h"
+
+#if TOUCH_DRIVER != TOUCH_DRV_SIM
+#error "test_touch_sim needs TOUCH_DRIVER=4 (env native_simtouch)"
+#endif
+
+using Sim = SimTouchDriver;
+static constexpr int32_t ONE = 1 << 16, HALF = 1 << 15;
+
+// -------- Fixture --------
+static host::Edges s_edges;
+using host::read_touch;
+
+// A panel mounted rotated and scaled against the display: what the calibration has to undo
+static int16_t panel_x(int32_t sx, int32_t sy) { (void)sx; return int16_t(2 * sy + 30); }
+static int16_t panel_y(int32_t sx, int32_t sy) { (void)sy; return int16_t(sx / 2 + 10); }
+
+void setUp() {
+  host::nvs_clear();
+  Sim::inject(0, 0, false);
+  (void)read_touch();                              // start every case released
+  touch_set_affine(touch_default_affine());
+  s_edges = {};
+}
+void tearDown() {}
+
+// -------- Mapping --------
+static void test_detect_sim() {
+  TEST_ASSERT_TRUE(touch_present());
+  TEST_ASSERT_EQUAL_STRING("SIM", touch_ic_name());
+  TEST_ASSERT_NOT_NULL(touch_indev());
+}
+
+static void test_default_mapping() {
+  lv_point_t p;
+  Sim::inject(100, 200, true);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(100 + TOUCH_X_OFFSET, p.x);
+  TEST_ASSERT_EQUAL(200 + TOUCH_Y_OFFSET, p.y);
+  int16_t rx, ry;
+  TEST_ASSERT_TRUE(touch_last_raw(rx, ry));
+  TEST_ASSERT_EQUAL(100, rx);
+  TEST_ASSERT_EQUAL(200, ry);
+
+  // Out-of-panel raw points clamp to the screen edges
+  Sim::inject(-50, TOUCH_SCREEN_H + 100, true);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(0, p.x);
+  TEST_ASSERT_EQUAL(TOUCH_SCREEN_H - 1, p.y);
+}
+
+static void test_custom_affine() {
+  // Swap axes, halve x: screen x = ry / 2 + 5, screen y = rx
+  const TouchAffine m{ 0, ONE / 2, 5 * ONE + HALF, ONE, 0, HALF };
+  touch_set_affine(m);
+  lv_point_t p;
+  Sim::inject(300, 600, true);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(305, p.x);
+  TEST_ASSERT_EQUAL(300, p.y);
+  TEST_ASSERT_EQUAL(m.c, touch_get_affine().c);
+}
+
+// -------- Press / release --------
+static void test_press_release_edges() {
+  for (int i = 0; i < 20; ++i) {
+    Sim::inject(400, 240, true);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch());   // held: no new edge
+    Sim::inject(400, 240, false);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, read_touch());
+  }
+  TEST_ASSERT_EQUAL(20, s_edges.pressed);
+  TEST_ASSERT_EQUAL(20, s_edges.released);
+}
+
+static void test_script_drag() {
+  Sim::run_script();                               // 0-1.2 s drag, 2.5-2.6 s tap
+  lv_point_t p;
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(300 + TOUCH_X_OFFSET, p.x);
+  delay(600);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(500 + TOUCH_X_OFFSET, p.x);
+  TEST_ASSERT_EQUAL(327 + TOUCH_Y_OFFSET, p.y);
+  delay(700);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, read_touch());
+  delay(1250);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+  TEST_ASSERT_EQUAL(72 + TOUCH_X_OFFSET, p.x);
+  delay(100);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, read_touch());
+  TEST_ASSERT_EQUAL(2, s_edges.pressed);
+  TEST_ASSERT_EQUAL(2, s_edges.released);
+}
+
+// -------- Calibration --------
+static void test_calibration() {
+  static const lv_point_t kTargets[] = {   // touch_calib.cpp target order
+    { 60, 60 }, { TOUCH_SCREEN_W - 60, TOUCH_SCREEN_H / 2 }, { TOUCH_SCREEN_W / 2, TOUCH_SCREEN_H - 60 },
+    { TOUCH_SCREEN_W - 60, 60 }, { 60, TOUCH_SCREEN_H - 60 },
+  };
+  TEST_ASSERT_TRUE(touch_calib_start(5));
+  TEST_ASSERT_TRUE(touch_calib_active());
+  for (const lv_point_t& t : kTargets) {
+    for (int i = 0; i < 3; ++i) {
+      Sim::inject(panel_x(t.x, t.y), panel_y(t.x, t.y), true);
+      (void)read_touch();
+    }
+    Sim::inject(0, 0, false);
+    (void)read_touch();
+  }
+  TEST_ASSERT_FALSE(touch_calib_active());
+  lv_timer_handler();                              // async delete of the calibration screen
+
+  // The fit undoes the panel transform anywhere on screen, not just at the targets
+  lv_point_t p;
+  for (int32_t sy = 20; sy < TOUCH_SCREEN_H; sy += 110) {
+    for (int32_t sx = 20; sx < TOUCH_SCREEN_W; sx += 130) {
+      Sim::inject(panel_x(sx, sy), panel_y(sx, sy), true);
+      TEST_ASSERT_EQUAL(LV_INDEV_STATE_PRESSED, read_touch(&p));
+      TEST_ASSERT_INT_WITHIN(1, sx, p.x);
+      TEST_ASSERT_INT_WITHIN(1, sy, p.y);
+    }
+  }
+
+  // Stored: survives a reset to the defaults
+  const TouchAffine fitted = touch_get_affine();
+  touch_set_affine(touch_default_affine());
+  TEST_ASSERT_TRUE(touch_calib_load());
+  TEST_ASSERT_EQUAL(fitted.a, touch_get_affine().a);
+  TEST_ASSERT_EQUAL(fitted.f, touch_get_affine().f);
+  touch_calib_clear();
+  TEST_ASSERT_FALSE(touch_calib_load());
+  TEST_ASSERT_EQUAL(touch_default_affine().f, touch_get_affine().f);
+}
+
+int main(int, char**) {
+  host::lv_setup();
+  host::lv_count_edges(lv_screen_active(), &s_edges);
+  touch_init_and_register_lvgl();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_detect_sim);
+  RUN_TEST(test_default_mapping);
+  RUN_TEST(test_custom_affine);
+  RUN_TEST(test_press_release_edges);
+  RUN_TEST(test_script_drag);
+  RUN_TEST(test_calibration);
+  return UNITY_END();
+}
@@ -0,0 +1,86 @@
+// test/test_touch_trace/test_main.cpp
+// Trace replay through LVGL (pio test -e native): a recorded run of short
+// taps, one sample pressed and one released, replayed at 1x and faster on
+// virtual time. Every recorded press/release must reach the UI as an edge,
+// even when several samples fall due between two indev reads.
+#include <unity.h>
+#include <lvgl.h>
+#include "touch_trace.h"
+#include "lv_host.h"
+
+static constexpr uint32_t TAPS = 40;
+static constexpr uint32_t STEP_MS = 33;   // one sample per recorded read
+
+// -------- Fixture --------
+static host::Edges s_edges;
+
+static void record_taps() {
+  touch_trace_start();
+  lv_indev_data_t d{};
+  for (uint32_t i = 0; i < TAPS; ++i) {
+    delay(STEP_MS);
+    d.point.x = int32_t(100 + i * 10); d.point.y = 200;
+    d.state = LV_INDEV_STATE_PRESSED;
+    touch_trace_record(&d);
+    delay(STEP_MS);
+    d.state = LV_INDEV_STATE_RELEASED;
+    touch_trace_record(&d);
+  }
+  touch_trace_stop();
+}
+
+// UI loop on virtual time until the replay hands back
+static uint32_t run_replay(uint8_t speed) {
+  TEST_ASSERT_TRUE(touch_trace_replay(speed));
+  uint32_t loops = 0;
+  while (touch_trace_replaying() && loops < 10000) {
+    delay(LV_DEF_REFR_PERIOD);
+    lv_timer_handler();
+    loops++;
+  }
+  TEST_ASSERT_FALSE(touch_trace_replaying());
+  return loops;
+}
+
+void setUp() { s_edges = {}; }
+void tearDown() {}
+
+// -------- Cases --------
+static void test_record() {
+  record_taps();
+  TEST_ASSERT_FALSE(touch_trace_recording());
+  TEST_ASSERT_EQUAL(TAPS * 2, touch_trace_count());
+}
+
+static void test_replay_1x() {
+  const uint32_t loops = run_replay(1);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.pressed);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.released);
+  TEST_ASSERT_GREATER_OR_EQUAL(TAPS * 2, loops);
+}
+
+static void test_replay_4x() {
+  // Four samples (two taps) fall due between reads
+  const uint32_t loops = run_replay(4);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.pressed);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.released);
+  TEST_ASSERT_LESS_THAN(TAPS, loops);
+}
+
+static void test_replay_16x() {
+  run_replay(16);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.pressed);
+  TEST_ASSERT_EQUAL(TAPS, s_edges.released);
+}
+
+int main(int, char**) {
+  host::lv_setup();
+  host::lv_count_edges(lv_screen_active(), &s_edges);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_record);
+  RUN_TEST(test_replay_1x);
+  RUN_TEST(test_replay_4x);
+  RUN_TEST(test_replay_16x);
+  return UNITY_END();
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Generate include/splash_image.h (RLE-compressed RGB565 boot splash).
+
+    python3 tools/make_splash.py                 # built-in design (moon + title)
+    python3 tools/make_splash.py splash.ppm      # any 800x480 binary PPM (P6)
+
+Format: pairs of uint16_t {run, color}; runs never exceed 0xFFFF and
+continue across row ends, so the decoder is a flat fill loop. Works best
+on flat-colour artwork (no dithering or anti-aliasing).
+"""
+import sys, os
+
+W, H = 800, 480
+BG = (0, 0, 0)
+
+# 5x7 glyphs for the title only
+FONT = {
+    'A': ["01110", "10001", "10001", "11111", "10001", "10001", "10001"],
+    'B': ["11110", "10001", "10001", "11110", "10001", "10001", "11110"],
+    'I': ["11111", "00100", "00100", "00100", "00100", "00100", "11111"],
+    'M': ["10001", "11011", "10101", "10101", "10001", "10001", "10001"],
+    'N': ["10001", "11001", "10101", "10011", "10001", "10001", "10001"],
+    'O': ["01110", "10001", "10001", "10001", "10001", "10001", "01110"],
+    'R': ["11110", "10001", "10001", "11110", "10100", "10010", "10001"],
+    'T': ["11111", "00100", "00100", "00100", "00100", "00100", "00100"],
+    'Y': ["10001", "10001", "01010", "00100", "00100", "00100", "00100"],
+    ' ': ["00000"] * 7,
+}
+
+
+def builtin():
+    px = [[BG] * W for _ in range(H)]
+
+    def disc(cx, cy, r, col):
+        for y in range(max(0, cy - r), min(H, cy + r + 1)):
+            for x in range(max(0, cx - r), min(W, cx + r + 1)):
+                if (x - cx) ** 2 + (y - cy) ** 2 <= r * r:
+                    px[y][x] = col
+
+    def rect(x0, y0, w, h, col):
+        for y in range(y0, y0 + h):
+            for x in range(x0, x0 + w):
+                px[y][x] = col
+
+    # Crescent moon: a disc with an offset background disc cut out of it
+    disc(400, 170, 80, (255, 236, 160))
+    disc(440, 140, 72, BG)
+    for sx, sy, r in ((540, 110, 6), (580, 200, 4), (290, 90, 5), (250, 210, 3), (610, 150, 3)):
+        disc(sx, sy, r, (255, 255, 0))
+
+    text, scale, gap = "BABY MONITOR", 6, 6
+    tw = len(text) * (5 * scale + gap) - gap
+    x = (W - tw) // 2
+    for ch in text:
+        for gy, row in enumerate(FONT[ch]):
+            for gx, bit in enumerate(row):
+                if bit == '1':
+                    rect(x + gx * scale, 300 + gy * scale, scale, scale, (255, 255, 255))
+        x += 5 * scale + gap
+
+    rect(300, 400, 200, 6, (48, 48, 48))      # empty "loading" track
+    return px
+
+
+def load_ppm(path):
+    data = open(path, 'rb').read()
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    pos += 1
+    if fields[0] != b'P6' or int(fields[1]) != W or int(fields[2]) != H or int(fields[3]) != 255:
+        sys.exit("expected a %dx%d 8-bit P6 PPM" % (W, H))
+    raw = data[pos:pos + W * H * 3]
+    return [[tuple(raw[(y * W + x) * 3:(y * W + x) * 3 + 3]) for x in range(W)] for y in range(H)]
+
+
+def rgb565(c):
+    r, g, b = c
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def rle(px):
+    out, cur, run = [], None, 0
+    for row in px:
+        for c in row:
+            v = rgb565(c)
+            if v == cur and run < 0xFFFF:
+                run += 1
+                continue
+            if run:
+                out.append((run, cur))
+            cur, run = v, 1
+    out.append((run, cur))
+    return out
+
+
+def main():
+    px = load_ppm(sys.argv[1]) if len(sys.argv) > 1 else builtin()
+    runs = rle(px)
+    dst = os.path.join(os.path.dirname(__file__), '..', 'include', 'splash_image.h')
+    with open(dst, 'w') as f:
+        f.write("#pragma once\n#include <stdint.h>\n\n")
+        f.write("// Generated by tools/make_splash.py -- do not edit\n")
+        f.write("// %dx%d RGB565, %d runs (%d bytes vs %d raw)\n"
+                % (W, H, len(runs), len(runs) * 4, W * H * 2))
+        f.write("static constexpr uint16_t SPLASH_W = %d, SPLASH_H = %d;\n" % (W, H))
+        f.write("static constexpr uint32_t SPLASH_RUNS = %d;\n" % len(runs))
+        f.write("static const uint16_t kSplashRle[SPLASH_RUNS * 2] = {\n")
+        for i in range(0, len(runs), 6):
+            f.write("  " + " ".join("%d,0x%04X," % r for r in runs[i:i + 6]) + "\n")
+        f.write("};\n")
+    print("%d runs, %d bytes" % (len(runs), len(runs) * 4))
+
+
+if __name__ == '__main__':
+    main()